@@ -0,0 +1,134 @@
+// DESCRIPTION: Verilator: Verilog example module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+//======================================================================
+
+// Runs many independent simulations ("lanes") of the same Verilated
+// model, for example many short tests of the same RTL with different
+// stimulus.
+//
+// Each lane has its own VerilatedContext and model instance, so lanes
+// have their own time, $finish state, and command arguments. Lanes that
+// have finished are masked off and no longer evaluated. The model is not
+// vectorized across lanes; copy and adapt this to your testbench.
+
+#ifndef BATCH_H_
+#define BATCH_H_
+
+#include <verilated.h>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//=============================================================================
+// Batch
+// Set of independent instances of model T_Model, evaluated together.
+//
+// Lockstep methods (eval, timeInc, forEach) must be called by a single
+// thread. run() evaluates lanes concurrently, each lane only ever being
+// evaluated by one thread.
+
+template <typename T_Model>
+class Batch final {
+    // TYPES
+    struct Lane final {
+        std::unique_ptr<VerilatedContext> m_contextp;  // Lane's simulation context
+        std::unique_ptr<T_Model> m_modelp;  // Lane's model instance
+    };
+
+    // MEMBERS
+    std::vector<Lane> m_lanes;  // All lanes
+
+public:
+    // CONSTRUCTORS
+    // Create a batch of 'lanes' model instances. 'argc'/'argv', if
+    // provided, are passed to the commandArgs of each lane's context.
+    explicit Batch(size_t lanes, int argc = 0, const char** argv = nullptr) {
+        m_lanes.resize(lanes);
+        for (Lane& lane : m_lanes) {
+            lane.m_contextp.reset(new VerilatedContext);
+            if (argc) lane.m_contextp->commandArgs(argc, argv);
+            lane.m_modelp.reset(new T_Model{lane.m_contextp.get()});
+        }
+    }
+    ~Batch() = default;
+    VL_UNCOPYABLE(Batch);
+    VL_UNMOVABLE(Batch);
+
+    // METHODS
+    // Number of lanes
+    size_t lanes() const VL_MT_SAFE { return m_lanes.size(); }
+    // Model instance of given lane
+    T_Model* modelp(size_t lane) const VL_MT_SAFE { return m_lanes[lane].m_modelp.get(); }
+    T_Model& operator[](size_t lane) const VL_MT_SAFE { return *modelp(lane); }
+    // Simulation context of given lane
+    VerilatedContext* contextp(size_t lane) const VL_MT_SAFE {
+        return m_lanes[lane].m_contextp.get();
+    }
+    // Return true if the given lane has not yet finished
+    bool active(size_t lane) const VL_MT_SAFE { return !contextp(lane)->gotFinish(); }
+    // Number of lanes that have not yet finished
+    size_t activeLanes() const VL_MT_SAFE {
+        return std::count_if(m_lanes.begin(), m_lanes.end(),
+                             [](const Lane& lane) { return !lane.m_contextp->gotFinish(); });
+    }
+    // Return true when all lanes have finished
+    bool gotFinish() const VL_MT_SAFE { return activeLanes() == 0; }
+
+    // Call 'f(lane, model)' for each active lane, e.g. to apply stimulus
+    template <typename T_Func>
+    void forEach(T_Func&& f) VL_MT_UNSAFE_ONE {
+        for (size_t lane = 0; lane < m_lanes.size(); ++lane) {
+            if (active(lane)) f(lane, *modelp(lane));
+        }
+    }
+    // Evaluate each active lane
+    void eval() VL_MT_UNSAFE_ONE {
+        for (Lane& lane : m_lanes) {
+            if (lane.m_contextp->gotFinish()) continue;
+            Verilated::threadContextp(lane.m_contextp.get());
+            lane.m_modelp->eval();
+        }
+    }
+    // Advance time of each active lane
+    void timeInc(uint64_t add) VL_MT_UNSAFE_ONE {
+        for (Lane& lane : m_lanes) {
+            if (!lane.m_contextp->gotFinish()) lane.m_contextp->timeInc(add);
+        }
+    }
+    // Run 'step(lane, model)' repeatedly for each lane until that lane
+    // finishes, spreading lanes over up to 'threads' threads. 'step' is
+    // expected to advance time and call eval() on the lane's model.
+    template <typename T_Func>
+    void run(unsigned threads, T_Func&& step) VL_MT_UNSAFE_ONE {
+        const auto runLanes = [&](size_t first, size_t stride) {
+            for (size_t lane = first; lane < m_lanes.size(); lane += stride) {
+                VerilatedContext* const ctxp = contextp(lane);
+                Verilated::threadContextp(ctxp);
+                while (!ctxp->gotFinish()) step(lane, *modelp(lane));
+            }
+        };
+        threads = std::max(1U, std::min(threads, static_cast<unsigned>(m_lanes.size())));
+        if (threads == 1) {
+            runLanes(0, 1);
+            return;
+        }
+        std::vector<std::thread> workers;
+        for (unsigned i = 1; i < threads; ++i) workers.emplace_back(runLanes, i, threads);
+        runLanes(0, threads);
+        for (std::thread& worker : workers) worker.join();
+    }
+    // Call final() on each lane's model
+    void final() VL_MT_UNSAFE_ONE {
+        for (Lane& lane : m_lanes) {
+            Verilated::threadContextp(lane.m_contextp.get());
+            lane.m_modelp->final();
+        }
+    }
+};
+
+#endif  // Guard
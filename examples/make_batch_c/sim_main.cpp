@@ -0,0 +1,82 @@
+// DESCRIPTION: Verilator: Verilog example module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+//======================================================================
+
+// Runs several independent simulations of "top.v", each with its own
+// seed and length, first in lockstep, then concurrently on several
+// threads, and checks each simulation's result.
+
+#include <cstdio>
+
+// Include common routines
+#include <verilated.h>
+
+// Include model header, generated from Verilating "top.v"
+#include "Vtop.h"
+
+// Batch of independent simulations, see batch.h
+#include "batch.h"
+
+static constexpr size_t LANES = 8;
+
+// Expected result of a lane, computed the same way as the model
+static uint32_t expectedSum(uint32_t seed, uint32_t cycles) {
+    uint32_t sum = 0;
+    for (uint32_t count = 0; count <= cycles; ++count) sum = (sum ^ seed) + count;
+    return sum;
+}
+
+static void setup(Batch<Vtop>& batch) {
+    batch.forEach([](size_t lane, Vtop& model) {
+        model.seed = lane * 0x1234567;
+        model.cycles = 10 + lane;
+    });
+}
+
+static bool check(const char* modep, Batch<Vtop>& batch) {
+    bool ok = true;
+    for (size_t lane = 0; lane < batch.lanes(); ++lane) {
+        const uint32_t sum = batch[lane].sum;
+        const uint32_t expected = expectedSum(lane * 0x1234567, 10 + lane);
+        std::printf("%s lane %zu: count=%u sum=%08x %s\n", modep, lane, batch[lane].count, sum,
+                    sum == expected ? "ok" : "MISMATCH");
+        if (batch.active(lane) || sum != expected) ok = false;
+    }
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    bool ok = true;
+    {
+        // Lockstep, lanes finishing at different cycles are masked off
+        Batch<Vtop> batch{LANES, argc, const_cast<const char**>(argv)};
+        setup(batch);
+        while (!batch.gotFinish()) {
+            batch.forEach([](size_t, Vtop& model) { model.clk = !model.clk; });
+            batch.eval();
+            batch.timeInc(1);
+        }
+        ok &= check("lockstep", batch);
+        batch.final();
+    }
+    {
+        // Concurrent, each lane runs to completion on one of the threads
+        Batch<Vtop> batch{LANES, argc, const_cast<const char**>(argv)};
+        setup(batch);
+        batch.run(4, [&](size_t lane, Vtop& model) {
+            model.clk = !model.clk;
+            model.eval();
+            batch.contextp(lane)->timeInc(1);
+        });
+        ok &= check("concurrent", batch);
+        batch.final();
+    }
+    if (!ok) {
+        std::fprintf(stderr, "%%Error: Batch results mismatch\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,23 @@
+// DESCRIPTION: Verilator: Verilog example module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// See also https://verilator.org/guide/latest/examples.html"
+
+module top (
+    input clk,
+    input [31:0] seed,
+    input [31:0] cycles,
+    output bit [31:0] count,
+    output bit [31:0] sum
+);
+
+  always @(posedge clk) begin
+    count <= count + 1;
+    sum <= (sum ^ seed) + count;
+    if (count == cycles) $finish;
+  end
+
+endmodule
@@ -0,0 +1,150 @@
+// DESCRIPTION: Verilator: Verilog example module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+//======================================================================
+
+// Client side of the shared memory co-simulation example, which is a
+// separate process from the model (sim_main.cpp). It checks the model's
+// responses against a C++ reference, and reports the throughput of one
+// cycle per round trip, as a socket or VPI based testbench would do,
+// versus pushing many cycles of stimulus at a time.
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Only needs the shared memory channel, not the Verilated runtime
+#include <verilated_cosim.h>
+
+// Record layouts, matching the order signals are added in sim_main.cpp
+struct Stimulus final {
+    uint32_t a;
+    uint32_t b;
+    uint8_t op;
+};
+static constexpr size_t STIM_BYTES = 9;  // a, b, op
+struct Response final {
+    uint32_t result;
+    uint64_t cycles;
+};
+static constexpr size_t RESP_BYTES = 12;  // result, cycles
+
+static void encode(const Stimulus& stim, uint8_t* recordp) {
+    std::memcpy(recordp + 0, &stim.a, 4);
+    std::memcpy(recordp + 4, &stim.b, 4);
+    std::memcpy(recordp + 8, &stim.op, 1);
+}
+static Response decode(const uint8_t* recordp) {
+    Response resp;
+    std::memcpy(&resp.result, recordp + 0, 4);
+    std::memcpy(&resp.cycles, recordp + 4, 8);
+    return resp;
+}
+
+// Reference model of top.v
+static uint32_t expected(const Stimulus& stim) {
+    switch (stim.op) {
+    case 0: return stim.a + stim.b;
+    case 1: return stim.a - stim.b;
+    case 2: return stim.a & stim.b;
+    default: return stim.a ^ stim.b;
+    }
+}
+
+class Client final {
+    VerilatedCosimChannel& m_chan;
+    uint64_t m_cycles = 0;  // Cycles run so far
+    uint64_t m_errors = 0;  // Mismatches found
+    uint32_t m_seed = 1;  // Stimulus random state
+
+    Stimulus random() {
+        const auto next = [this]() {
+            m_seed = m_seed * 1664525U + 1013904223U;
+            return m_seed;
+        };
+        Stimulus stim;
+        stim.a = next();
+        stim.b = next();
+        stim.op = next() >> 30;
+        return stim;
+    }
+    void check(const Stimulus& stim, const Response& resp) {
+        ++m_cycles;
+        if (resp.result == expected(stim) && resp.cycles == m_cycles) return;
+        if (++m_errors < 10) {
+            std::printf("%%Error: cycle %" PRIu64 ": got %08x/%" PRIu64 " expected %08x\n",
+                        m_cycles, resp.result, resp.cycles, expected(stim));
+        }
+    }
+
+public:
+    explicit Client(VerilatedCosimChannel& chan)
+        : m_chan{chan} {}
+    uint64_t errors() const { return m_errors; }
+
+    // Run 'cycles' cycles, 'batch' cycles per exchange, returning seconds taken
+    double run(uint64_t cycles, size_t batch) {
+        std::vector<Stimulus> stims(batch);
+        std::vector<uint8_t> stimBuf(batch * STIM_BYTES);
+        std::vector<uint8_t> respBuf(batch * RESP_BYTES);
+        const auto start = std::chrono::steady_clock::now();
+        for (uint64_t done = 0; done < cycles; done += batch) {
+            const size_t n = std::min<uint64_t>(batch, cycles - done);
+            for (size_t i = 0; i < n; ++i) {
+                stims[i] = random();
+                encode(stims[i], &stimBuf[i * STIM_BYTES]);
+            }
+            m_chan.exchange(stimBuf.data(), respBuf.data(), n);
+            for (size_t i = 0; i < n; ++i) check(stims[i], decode(&respBuf[i * RESP_BYTES]));
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::printf("Batch %5zu: %9" PRIu64 " cycles in %7.3f s, %10.0f cycles/s\n", batch,
+                    cycles, elapsed.count(), cycles / elapsed.count());
+        return elapsed.count();
+    }
+};
+
+int main(int argc, char** argv) {
+    const char* const namep = argc > 1 ? argv[1] : "vl_cosim";
+    const uint64_t cycles = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000000;
+
+    // The model may not have created the channel yet, so retry for a while
+    std::unique_ptr<VerilatedCosimChannel> chanp;
+    for (int tries = 0; !chanp && tries < 1000; ++tries) {
+        chanp = VerilatedCosimChannel::open(namep);
+        if (!chanp) std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    if (!chanp) {
+        std::fprintf(stderr, "%%Error: Cannot open shared memory '%s'\n", namep);
+        return 1;
+    }
+    if (chanp->stimBytes() != STIM_BYTES || chanp->respBytes() != RESP_BYTES) {
+        std::fprintf(stderr, "%%Error: Record sizes %zu/%zu do not match client\n",
+                     chanp->stimBytes(), chanp->respBytes());
+        chanp->close();
+        return 1;
+    }
+
+    Client client{*chanp};
+    // One cycle per round trip, then increasingly large batches
+    const double base = client.run(cycles / 10, 1) * 10;
+    for (const size_t batch : {16, 256, 1024}) {
+        const double secs = client.run(cycles, batch);
+        std::printf("            %.1fx faster than batch 1\n", base / secs);
+    }
+    chanp->close();
+
+    if (client.errors()) {
+        std::printf("%%Error: %" PRIu64 " mismatches\n", client.errors());
+        return 1;
+    }
+    std::printf("All responses match\n");
+    return 0;
+}
@@ -0,0 +1,74 @@
+// DESCRIPTION: Verilator: Verilog example module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+//======================================================================
+
+// Model side of the shared memory co-simulation example. This creates the
+// channel, then evaluates one clock cycle for each stimulus record the
+// client (client.cpp) pushes, until the client closes the channel.
+
+#include <cstdio>
+#include <initializer_list>
+#include <memory>
+
+// Include common routines
+#include <verilated.h>
+#include <verilated_cosim.h>
+#include <verilated_vpi.h>
+
+// Include model header, generated from Verilating "top.v"
+#include "Vtop.h"
+
+// Add the named signals to a bulk signal set
+static bool addSignals(VerilatedVpiBulk& bulk, std::initializer_list<const char*> names) {
+    for (const char* const namep : names) {
+        const vpiHandle handle = vpi_handle_by_name(const_cast<PLI_BYTE8*>(namep), nullptr);
+        if (!handle || bulk.add(handle) < 0) {
+            std::fprintf(stderr, "%%Error: Cannot add signal '%s'\n", namep);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* const namep = argc > 1 ? argv[1] : "vl_cosim";
+
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    const std::unique_ptr<Vtop> top{new Vtop{contextp.get()}};
+    top->clk = 0;
+    top->eval();
+
+    // Signals written from each stimulus record, and read into each
+    // response record, which must be public_flat_rw (see the Makefile).
+    // Records hold each signal's value in the order added, each taking its
+    // width rounded up to whole bytes.
+    VerilatedVpiBulk inputs;
+    VerilatedVpiBulk outputs;
+    if (!addSignals(inputs, {"top.a", "top.b", "top.op"})) return 1;
+    if (!addSignals(outputs, {"top.result", "top.cycles"})) return 1;
+
+    const std::unique_ptr<VerilatedCosimChannel> chanp
+        = VerilatedCosimChannel::create(namep, inputs.bytes(), outputs.bytes());
+    if (!chanp) {
+        std::perror("%Error: VerilatedCosimChannel::create");
+        return 1;
+    }
+    VL_PRINTF("Serving on shared memory '%s'\n", chanp->name().c_str());
+
+    // Each stimulus record is one clock cycle
+    const uint64_t served = chanp->serve(inputs, outputs, [&]() {
+        top->clk = 1;
+        top->eval();
+        contextp->timeInc(1);
+        top->clk = 0;
+        top->eval();
+        contextp->timeInc(1);
+    });
+    VL_PRINTF("Served %" PRIu64 " cycles\n", served);
+
+    top->final();
+    return 0;
+}
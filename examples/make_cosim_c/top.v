@@ -0,0 +1,30 @@
+// DESCRIPTION: Verilator: Verilog example module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// See also https://verilator.org/guide/latest/examples.html"
+
+module top (
+    input clk,
+    input [31:0] a,
+    input [31:0] b,
+    input [1:0] op,
+    output reg [31:0] result,
+    output reg [63:0] cycles
+);
+
+  initial cycles = 0;
+
+  always @(posedge clk) begin
+    case (op)
+      2'd0: result <= a + b;
+      2'd1: result <= a - b;
+      2'd2: result <= a & b;
+      default: result <= a ^ b;
+    endcase
+    cycles <= cycles + 1;
+  end
+
+endmodule
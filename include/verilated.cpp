@@ -77,6 +77,10 @@
 # include <sys/time.h>
 # include <sys/resource.h>
 # define _VL_HAVE_GETRLIMIT
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <unistd.h>
+# define _VL_HAVE_MMAP
 #endif
 
 #include "verilated_threads.h"
@@ -2258,51 +2262,89 @@ static const char* formatBinary(int nBits, uint32_t bits) {
     return t_buf;
 }
 
+// Character classes for $readmem parsing, and digit value in the low bits
+enum : uint8_t { READMEM_VALUE = 0xf, READMEM_HEX2 = 0x10, READMEM_BIN4 = 0x20 };
+static const std::array<uint8_t, 256> s_readMemClass = []() {
+    std::array<uint8_t, 256> table{};
+    for (int c = '0'; c <= '9'; ++c) table[c] = READMEM_HEX2 | (c - '0');
+    for (int c = 'a'; c <= 'f'; ++c) table[c] = READMEM_HEX2 | (c - 'a' + 10);
+    for (int c = 'A'; c <= 'F'; ++c) table[c] = READMEM_HEX2 | (c - 'A' + 10);
+    for (const char c : std::string{"01xXzZ"}) table[static_cast<uint8_t>(c)] |= READMEM_BIN4;
+    return table;
+}();
+static inline uint8_t readMemClass(char c) VL_PURE {
+    return s_readMemClass[static_cast<uint8_t>(c)];
+}
+
 VlReadMem::VlReadMem(bool hex, int bits, const std::string& filename, QData start, QData end)
     : m_hex{hex}
     , m_bits{bits}
     , m_filename(filename)  // Need () or GCC 4.8 false warning
     , m_end{end}
     , m_addr{start} {
-    m_fp = std::fopen(filename.c_str(), "r");
-    if (VL_UNLIKELY(!m_fp)) {
-        // We don't report the Verilog source filename as it slow to have to pass it down
-        VL_WARN_MT(filename.c_str(), 0, "", "$readmem file not found");
-        return;
+    // Memory files may be very large, so map rather than read when possible
+    FILE* fp = nullptr;
+#ifdef _VL_HAVE_MMAP
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat st;
+        if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            const size_t size = static_cast<size_t>(st.st_size);
+            void* const mapp = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapp != MAP_FAILED) {
+                ::madvise(mapp, size, MADV_SEQUENTIAL);
+                m_mapSize = size;
+                m_datap = static_cast<const char*>(mapp);
+            }
+        }
+        // Read anything else through the same descriptor, as opening e.g. a
+        // FIFO again would lose what its writer already sent
+        if (!m_datap) fp = ::fdopen(fd, "r");
+        if (!fp) ::close(fd);
+    }
+#endif
+    if (!m_datap) {
+        if (!fp) fp = std::fopen(filename.c_str(), "r");
+        if (VL_UNLIKELY(!fp)) {
+            // We don't report the Verilog source filename as it slow to have to pass it down
+            VL_WARN_MT(filename.c_str(), 0, "", "$readmem file not found");
+            return;
+        }
+        char buf[64 * 1024];
+        while (const size_t got = std::fread(buf, 1, sizeof(buf), fp)) m_buffer.append(buf, got);
+        std::fclose(fp);
+        m_datap = m_buffer.data();
     }
+    m_cp = m_datap;
+    m_endp = m_datap + (m_mapSize ? m_mapSize : m_buffer.size());
 }
 VlReadMem::~VlReadMem() {
-    if (m_fp) {
-        std::fclose(m_fp);
-        m_fp = nullptr;
-    }
+#ifdef _VL_HAVE_MMAP
+    if (m_mapSize) ::munmap(const_cast<char*>(m_datap), m_mapSize);
+#endif
 }
 bool VlReadMem::get(QData& addrr, std::string& valuer) {
-    if (VL_UNLIKELY(!m_fp)) return false;
-    valuer = "";
+    if (VL_UNLIKELY(!m_datap)) return false;
+    valuer.clear();
     // Prep for reading
     bool inData = false;
     bool ignoreToEol = false;
     bool ignoreToComment = false;
     bool readingAddress = false;
     int lastCh = ' ';
-    // Read the data
-    // We process a character at a time, as then we don't need to deal
-    // with changing buffer sizes dynamically, etc.
-    while (true) {
-        int c = std::fgetc(m_fp);
-        if (VL_UNLIKELY(c == EOF)) break;
-        const bool chIs4StateBin
-            = c == '0' || c == '1' || c == 'x' || c == 'X' || c == 'z' || c == 'Z';
-        const bool chIs2StateHex = std::isxdigit(c);
-        const bool chIs4StateHex = std::isxdigit(c) || chIs4StateBin;
+    // Read the data, a character at a time from the file contents
+    while (m_cp != m_endp) {
+        int c = static_cast<unsigned char>(*m_cp++);
+        if (c == '_') continue;  // Ignore _ e.g. inside a number
+        const uint8_t cls = readMemClass(c);
+        const bool chIs2StateHex = cls & READMEM_HEX2;
+        const bool chIs4StateHex = cls & (READMEM_HEX2 | READMEM_BIN4);
         // printf("%d: Got '%c' Addr%lx IN%d IgE%d IgC%d\n",
         //        m_linenum, c, m_addr, inData, ignoreToEol, ignoreToComment);
         // See if previous data value has completed, and if so return
-        if (c == '_') continue;  // Ignore _ e.g. inside a number
         if (inData && !chIs4StateHex) {
             // printf("Got data @%lx = %s\n", m_addr, valuer.c_str());
-            ungetc(c, m_fp);
+            --m_cp;
             addrr = m_addr;
             ++m_addr;
             return true;
@@ -2332,22 +2374,41 @@ bool VlReadMem::get(QData& addrr, std::string& valuer) {
                 m_anyAddr = true;
                 m_addr = 0;
             } else if (readingAddress && chIs2StateHex) {
-                c = std::tolower(c);
-                const int addressValue = (c >= 'a') ? (c - 'a' + 10) : (c - '0');
-                m_addr = (m_addr << 4) + addressValue;
+                m_addr = (m_addr << 4) + (cls & READMEM_VALUE);
             } else if (readingAddress && chIs4StateHex) {
                 VL_FATAL_MT(m_filename.c_str(), m_linenum, "",
                             "$readmem address contains 4-state characters");
             } else if (chIs4StateHex) {
                 inData = true;
-                valuer += static_cast<char>(c);
-                if (VL_UNLIKELY(!m_hex && !chIs4StateBin)) {
-                    VL_FATAL_MT(m_filename.c_str(), m_linenum, "",
-                                "$readmemb (binary) file contains hex characters");
+                // Take the rest of the value at once, the next loop iteration
+                // will see the character after it
+                const char* const startp = m_cp - 1;
+                while (m_cp != m_endp
+                       && ((readMemClass(*m_cp) & (READMEM_HEX2 | READMEM_BIN4))
+                           || *m_cp == '_')) {
+                    ++m_cp;
+                }
+                valuer.append(startp, m_cp - startp);
+                if (VL_UNLIKELY(valuer.find('_') != std::string::npos)) {
+                    valuer.erase(std::remove(valuer.begin(), valuer.end(), '_'), valuer.end());
+                }
+                if (!m_hex) {
+                    for (const char vc : valuer) {
+                        if (VL_UNLIKELY(!(readMemClass(vc) & READMEM_BIN4))) {
+                            VL_FATAL_MT(m_filename.c_str(), m_linenum, "",
+                                        "$readmemb (binary) file contains hex characters");
+                        }
+                    }
                 }
             } else {
                 VL_FATAL_MT(m_filename.c_str(), m_linenum, "", "$readmem file syntax error");
             }
+        } else if (ignoreToEol) {
+            // Skip rest of // or # comment quickly
+            const char* const eolp
+                = static_cast<const char*>(std::memchr(m_cp, '\n', m_endp - m_cp));
+            m_cp = eolp ? eolp : m_endp;
+            c = ' ';
         }
         lastCh = c;
     }
@@ -2361,38 +2422,44 @@ bool VlReadMem::get(QData& addrr, std::string& valuer) {
     return inData;  // EOF
 }
 void VlReadMem::setData(void* valuep, const std::string& rhs) {
-    const QData shift = m_hex ? 4ULL : 1ULL;
-    bool innum = false;
-    // Shift value in
-    for (const auto& i : rhs) {
-        const char c = std::tolower(i);
-        const int value = (c == 'x' || c == 'z') ? VL_RAND_RESET_I(m_hex ? 4 : 1)
-                          : (c >= 'a')           ? (c - 'a' + 10)
-                                                 : (c - '0');
+    if (VL_UNLIKELY(rhs.empty())) return;
+    const int shift = m_hex ? 4 : 1;
+    // The position of each digit is known from the number of digits, so
+    // place digits directly, rather than shifting the whole value per digit.
+    // Digits are visited most significant first, so X/Z randomization
+    // happens in file order.
+    int lsb = static_cast<int>(rhs.size()) * shift;
+    const auto digitValue = [&](char c) -> IData {
+        const uint8_t cls = readMemClass(c);
+        return (cls & READMEM_HEX2) ? (cls & READMEM_VALUE) : VL_RAND_RESET_I(shift);
+    };
+    if (m_bits <= VL_QUADSIZE) {
+        QData data = 0;
+        for (const char c : rhs) {
+            lsb -= shift;
+            const QData value = digitValue(c);
+            if (lsb < VL_QUADSIZE) data |= value << lsb;
+        }
+        data &= VL_MASK_Q(m_bits);
         if (m_bits <= 8) {
-            CData* const datap = reinterpret_cast<CData*>(valuep);
-            if (!innum) *datap = 0;
-            *datap = ((*datap << shift) + value) & VL_MASK_I(m_bits);
+            *reinterpret_cast<CData*>(valuep) = static_cast<CData>(data);
         } else if (m_bits <= 16) {
-            SData* const datap = reinterpret_cast<SData*>(valuep);
-            if (!innum) *datap = 0;
-            *datap = ((*datap << shift) + value) & VL_MASK_I(m_bits);
+            *reinterpret_cast<SData*>(valuep) = static_cast<SData>(data);
         } else if (m_bits <= VL_IDATASIZE) {
-            IData* const datap = reinterpret_cast<IData*>(valuep);
-            if (!innum) *datap = 0;
-            *datap = ((*datap << shift) + value) & VL_MASK_I(m_bits);
-        } else if (m_bits <= VL_QUADSIZE) {
-            QData* const datap = reinterpret_cast<QData*>(valuep);
-            if (!innum) *datap = 0;
-            *datap = ((*datap << static_cast<QData>(shift)) + static_cast<QData>(value))
-                     & VL_MASK_Q(m_bits);
+            *reinterpret_cast<IData*>(valuep) = static_cast<IData>(data);
         } else {
-            WDataOutP datap = reinterpret_cast<WDataOutP>(valuep);
-            if (!innum) VL_ZERO_W(m_bits, datap);
-            _vl_shiftl_inplace_w(m_bits, datap, static_cast<IData>(shift));
-            datap[0] |= value;
+            *reinterpret_cast<QData*>(valuep) = data;
         }
-        innum = true;
+    } else {
+        WDataOutP const datap = reinterpret_cast<WDataOutP>(valuep);
+        VL_ZERO_W(m_bits, datap);
+        for (const char c : rhs) {
+            lsb -= shift;
+            const EData value = digitValue(c);
+            // Digits never straddle words, as shift divides VL_EDATASIZE
+            if (lsb < m_bits) datap[VL_BITWORD_E(lsb)] |= value << VL_BITBIT_E(lsb);
+        }
+        datap[VL_WORDS_I(m_bits) - 1] &= VL_MASK_E(m_bits);
     }
 }
 
@@ -3208,23 +3275,21 @@ void VerilatedContext::scopesDump() const VL_MT_SAFE {
 void VerilatedContextImp::scopeInsert(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at construction
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
-    const auto it = m_impdatap->m_nameMap.find(scopep->name());
-    if (it == m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.emplace(scopep->name(), scopep);
+    m_impdatap->m_nameMap.scopeInsert(scopep->name(), scopep);
+    VerilatedImp::namesChanged();
 }
 void VerilatedContextImp::scopeErase(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at destruction
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     VerilatedImp::userEraseScope(scopep);
-    const auto it = m_impdatap->m_nameMap.find(scopep->name());
-    if (it != m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.erase(it);
+    m_impdatap->m_nameMap.scopeErase(scopep->name());
+    VerilatedImp::namesChanged();
 }
 const VerilatedScope* VerilatedContext::scopeFind(const char* namep) const VL_MT_SAFE {
     // Thread save only assuming this is called only after model construction completed
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     // If too slow, can assume this is only VL_MT_SAFE_POSINIT
-    const auto& it = m_impdatap->m_nameMap.find(namep);
-    if (VL_UNLIKELY(it == m_impdatap->m_nameMap.end())) return nullptr;
-    return it->second;
+    return m_impdatap->m_nameMap.scopeFind(namep);
 }
 const VerilatedScopeNameMap* VerilatedContext::scopeNameMap() VL_MT_SAFE {
     return &(impp()->m_impdatap->m_nameMap);
@@ -3615,15 +3680,32 @@ void VerilatedScope::varInsert(const char* namep, void* datap, bool isParam,
     }
     va_end(ap);
 
-    m_varsp->emplace(namep, var);
+    m_varsp->varInsert(namep, var);
+    VerilatedImp::namesChanged();
+}
+
+std::pair<VerilatedVarNameMap::iterator, bool>
+VerilatedVarNameMap::insert(const value_type& value) VL_MT_UNSAFE {
+    const auto pair = Base::insert(value);
+    if (pair.second) m_index.emplace(pair.first->first, &pair.first->second);
+    VerilatedImp::namesChanged();
+    return pair;
+}
+
+VerilatedVarNameMap::iterator VerilatedVarNameMap::erase(const_iterator it) VL_MT_UNSAFE {
+    m_index.erase(it->first);
+    VerilatedImp::namesChanged();
+    return Base::erase(it);
+}
+
+void VerilatedScope::varChangedFlag(const char* namep, CData* changedp) VL_MT_UNSAFE {
+    // Called after varInsert, when the model sets a flag on writes to the variable
+    if (VerilatedVar* const varp = varFind(namep)) varp->m_changedp = changedp;
 }
 
 // cppcheck-suppress unusedFunction  // Used by applications
 VerilatedVar* VerilatedScope::varFind(const char* namep) const VL_MT_SAFE_POSTINIT {
-    if (VL_LIKELY(m_varsp)) {
-        const auto it = m_varsp->find(namep);
-        if (VL_LIKELY(it != m_varsp->end())) return &(it->second);
-    }
+    if (VL_LIKELY(m_varsp)) return m_varsp->varFind(namep);
     return nullptr;
 }
 
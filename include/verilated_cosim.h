@@ -0,0 +1,397 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated shared memory co-simulation header
+///
+/// This may be included in user wrapper code that drives a Verilated model
+/// from another process, for example a testbench written in another
+/// language or running in another simulator.
+///
+/// A channel is a POSIX shared memory object holding two lock-free single
+/// producer, single consumer rings of fixed size records: stimulus from
+/// the client process to the model, and responses from the model back to
+/// the client. The client may push many cycles of stimulus before pulling
+/// any response, so the processes do not wait on each other every cycle.
+///
+/// This header does not depend on the Verilated runtime library, so may
+/// also be included by the client. On the model side,
+/// VerilatedCosimChannel::serve connects a channel to VerilatedVpiBulk
+/// signal sets, see verilated_vpi.h.
+///
+//=============================================================================
+
+#ifndef VERILATOR_VERILATED_COSIM_H_
+#define VERILATOR_VERILATED_COSIM_H_
+
+#include "verilatedos.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32) || defined(__MINGW32__)
+#error "verilated_cosim.h requires POSIX shared memory, which this platform does not provide"
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Used by serve() on the model side, defined by the Verilated runtime library
+extern void VL_FATAL_MT(const char* filename, int linenum, const char* hier,
+                        const char* msg) VL_MT_SAFE;
+
+//=============================================================================
+// VerilatedCosimChannel
+/// Shared memory channel between a Verilated model and a client process.
+///
+/// Each side must only be used by a single thread. The model side creates
+/// the channel, and removes it when destroyed; the client side opens it.
+
+class VerilatedCosimChannel final {
+    // TYPES
+    static constexpr uint32_t MAGIC = 0x53434c56;  // "VLCS"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr int SPINS_BEFORE_YIELD = 1024;
+    // Ring indices, each written by only one side, so on separate cache lines
+    struct RingIndices final {
+        alignas(VL_CACHE_LINE_BYTES) std::atomic<uint64_t> m_head;  // Records pushed
+        alignas(VL_CACHE_LINE_BYTES) std::atomic<uint64_t> m_tail;  // Records pulled
+    };
+    // Start of the shared memory object, followed by the ring records
+    struct Header final {
+        uint32_t m_magic;  // MAGIC
+        uint32_t m_version;  // VERSION
+        uint32_t m_depth;  // Records in each ring, a power of 2
+        uint32_t m_stimBytes;  // Bytes in each stimulus record
+        uint32_t m_respBytes;  // Bytes in each response record
+        std::atomic<uint32_t> m_ready;  // Set when the model side has initialized
+        std::atomic<uint32_t> m_closed;  // Set when client has no more stimulus
+        RingIndices m_stim;  // Client to model ring
+        RingIndices m_resp;  // Model to client ring
+    };
+    // One side's view of a ring
+    struct Ring final {
+        RingIndices* m_indicesp = nullptr;  // Shared indices
+        uint8_t* m_recordsp = nullptr;  // Shared records
+        size_t m_bytes = 0;  // Bytes in each record
+        size_t m_stride = 0;  // Bytes between records
+        uint64_t m_mask = 0;  // Depth - 1
+        uint64_t m_otherIndex = 0;  // Last seen index written by the other side
+
+        // Push up to 'count' records, return number pushed
+        size_t push(const uint8_t* srcp, size_t count) {
+            const uint64_t head = m_indicesp->m_head.load(std::memory_order_relaxed);
+            const uint64_t depth = m_mask + 1;
+            if (head - m_otherIndex + count > depth) {
+                m_otherIndex = m_indicesp->m_tail.load(std::memory_order_acquire);
+            }
+            count = std::min<size_t>(count, depth - (head - m_otherIndex));
+            for (size_t i = 0; i < count; ++i) {
+                std::memcpy(m_recordsp + ((head + i) & m_mask) * m_stride, srcp + i * m_bytes,
+                            m_bytes);
+            }
+            if (count) m_indicesp->m_head.store(head + count, std::memory_order_release);
+            return count;
+        }
+        // Pull up to 'count' records, return number pulled
+        size_t pull(uint8_t* dstp, size_t count) {
+            const uint64_t tail = m_indicesp->m_tail.load(std::memory_order_relaxed);
+            if (m_otherIndex - tail < count) {
+                m_otherIndex = m_indicesp->m_head.load(std::memory_order_acquire);
+            }
+            count = std::min<size_t>(count, m_otherIndex - tail);
+            for (size_t i = 0; i < count; ++i) {
+                std::memcpy(dstp + i * m_bytes, m_recordsp + ((tail + i) & m_mask) * m_stride,
+                            m_bytes);
+            }
+            if (count) m_indicesp->m_tail.store(tail + count, std::memory_order_release);
+            return count;
+        }
+        bool empty() const {
+            return m_indicesp->m_head.load(std::memory_order_acquire)
+                   == m_indicesp->m_tail.load(std::memory_order_relaxed);
+        }
+    };
+
+    // MEMBERS
+    std::string m_name;  // Shared memory object name
+    bool m_model;  // Model side, which created the object
+    Header* m_headerp = nullptr;  // Mapped shared memory
+    size_t m_size = 0;  // Size of mapping
+    Ring m_stim;  // Stimulus ring
+    Ring m_resp;  // Response ring
+
+    // CONSTRUCTORS
+    VerilatedCosimChannel(const std::string& name, bool model)
+        : m_name{name}
+        , m_model{model} {}
+
+public:
+    ~VerilatedCosimChannel() {
+        if (m_headerp) munmap(m_headerp, m_size);
+        if (m_model) shm_unlink(m_name.c_str());
+    }
+    VL_UNCOPYABLE(VerilatedCosimChannel);
+    VL_UNMOVABLE(VerilatedCosimChannel);
+
+    /// Create a channel, from the model side, with records of the given
+    /// sizes, and given number of records in each ring (rounded up to a
+    /// power of 2). Any existing channel of the same name is replaced.
+    /// Returns nullptr, with errno set, on failure.
+    static std::unique_ptr<VerilatedCosimChannel> create(const std::string& name,
+                                                         size_t stimBytes, size_t respBytes,
+                                                         size_t depth = 1024) {
+        std::unique_ptr<VerilatedCosimChannel> chanp{
+            new VerilatedCosimChannel{shmName(name), true}};
+        uint32_t depthPow2 = 1;
+        while (depthPow2 < depth) depthPow2 <<= 1;
+        shm_unlink(chanp->m_name.c_str());
+        const int fd = shm_open(chanp->m_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd < 0) {
+            chanp->m_model = false;  // Not ours to unlink
+            return nullptr;
+        }
+        const size_t size = mapSize(depthPow2, stimBytes, respBytes);
+        const bool ok = ftruncate(fd, static_cast<off_t>(size)) == 0 && chanp->map(fd, size);
+        ::close(fd);
+        if (!ok) return nullptr;
+        Header* const hp = new (chanp->m_headerp) Header;
+        hp->m_magic = MAGIC;
+        hp->m_version = VERSION;
+        hp->m_depth = depthPow2;
+        hp->m_stimBytes = static_cast<uint32_t>(stimBytes);
+        hp->m_respBytes = static_cast<uint32_t>(respBytes);
+        hp->m_closed.store(0, std::memory_order_relaxed);
+        hp->m_stim.m_head.store(0, std::memory_order_relaxed);
+        hp->m_stim.m_tail.store(0, std::memory_order_relaxed);
+        hp->m_resp.m_head.store(0, std::memory_order_relaxed);
+        hp->m_resp.m_tail.store(0, std::memory_order_relaxed);
+        chanp->setupRings();
+        hp->m_ready.store(1, std::memory_order_release);
+        return chanp;
+    }
+    /// Open a channel, from the client side. Returns nullptr if the channel
+    /// does not exist or is not yet initialized by the model side, so the
+    /// caller may retry.
+    static std::unique_ptr<VerilatedCosimChannel> open(const std::string& name) {
+        std::unique_ptr<VerilatedCosimChannel> chanp{
+            new VerilatedCosimChannel{shmName(name), false}};
+        const int fd = shm_open(chanp->m_name.c_str(), O_RDWR, 0);
+        if (fd < 0) return nullptr;
+        struct stat st;
+        bool ok = fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(Header)
+                  && chanp->map(fd, st.st_size);
+        ::close(fd);
+        if (!ok) return nullptr;
+        const Header* const hp = chanp->m_headerp;
+        ok = hp->m_ready.load(std::memory_order_acquire) && hp->m_magic == MAGIC
+             && hp->m_version == VERSION
+             && chanp->m_size >= mapSize(hp->m_depth, hp->m_stimBytes, hp->m_respBytes);
+        if (!ok) return nullptr;
+        chanp->setupRings();
+        return chanp;
+    }
+
+    // METHODS
+    /// Shared memory object name
+    const std::string& name() const { return m_name; }
+    /// Bytes in each stimulus record
+    size_t stimBytes() const { return m_stim.m_bytes; }
+    /// Bytes in each response record
+    size_t respBytes() const { return m_resp.m_bytes; }
+    /// Records in each ring
+    size_t depth() const { return m_stim.m_mask + 1; }
+
+    // Client side methods
+    /// Push up to 'count' stimulus records without waiting, returning the
+    /// number pushed
+    size_t pushStimulus(const void* bufp, size_t count) {
+        return m_stim.push(static_cast<const uint8_t*>(bufp), count);
+    }
+    /// Push 'count' stimulus records, waiting for space as needed. The
+    /// model side waits for space for responses, so a client pushing more
+    /// than depth() records ahead of the responses it has pulled must use
+    /// exchange() instead, or pull responses from another thread.
+    void pushStimulusAll(const void* bufp, size_t count) {
+        transferAll(count, [&](size_t done, size_t n) {
+            return m_stim.push(static_cast<const uint8_t*>(bufp) + done * stimBytes(), n);
+        });
+    }
+    /// Pull up to 'count' response records without waiting, returning the
+    /// number pulled
+    size_t pullResponses(void* bufp, size_t count) {
+        return m_resp.pull(static_cast<uint8_t*>(bufp), count);
+    }
+    /// Pull 'count' response records, waiting for them as needed
+    void pullResponsesAll(void* bufp, size_t count) {
+        transferAll(count, [&](size_t done, size_t n) {
+            return m_resp.pull(static_cast<uint8_t*>(bufp) + done * respBytes(), n);
+        });
+    }
+    /// Push 'count' stimulus records, and pull their 'count' response
+    /// records, interleaving the two so the model never waits for the
+    /// client to make room for responses. Responses to any stimulus pushed
+    /// earlier must have been pulled.
+    void exchange(const void* stimp, void* respp, size_t count) {
+        size_t pushed = 0;
+        size_t pulled = 0;
+        int spins = 0;
+        while (pulled < count) {
+            size_t n = 0;
+            if (pushed < count) {
+                n = pushStimulus(static_cast<const uint8_t*>(stimp) + pushed * stimBytes(),
+                                 count - pushed);
+                pushed += n;
+            }
+            const size_t m = pullResponses(
+                static_cast<uint8_t*>(respp) + pulled * respBytes(), count - pulled);
+            pulled += m;
+            if (n || m) {
+                spins = 0;
+            } else {
+                pause(spins);
+            }
+        }
+    }
+    /// Indicate the client will push no more stimulus
+    void close() { m_headerp->m_closed.store(1, std::memory_order_release); }
+
+    // Model side methods
+    /// Pull up to 'count' stimulus records without waiting, returning the
+    /// number pulled
+    size_t pullStimulus(void* bufp, size_t count) {
+        return m_stim.pull(static_cast<uint8_t*>(bufp), count);
+    }
+    /// Push 'count' response records, waiting for space as needed
+    void pushResponsesAll(const void* bufp, size_t count) {
+        transferAll(count, [&](size_t done, size_t n) {
+            return m_resp.push(static_cast<const uint8_t*>(bufp) + done * respBytes(), n);
+        });
+    }
+    /// Return true when the client has closed the channel, and all
+    /// stimulus has been pulled
+    bool closed() const {
+        return m_headerp->m_closed.load(std::memory_order_acquire) && m_stim.empty();
+    }
+    /// Serve the client until it closes the channel, returning the number of
+    /// records served. For each stimulus record, write it to 'inputs', call
+    /// 'step()', which is expected to evaluate the model, typically over
+    /// one clock cycle, then read 'outputs' into a response record.
+    /// 'inputs' and 'outputs' are VerilatedVpiBulk signal sets, with sizes
+    /// matching the channel's records, else this is fatal. Up to 'batch'
+    /// records are transferred at once.
+    template <typename T_Bulk, typename T_Step>
+    uint64_t serve(T_Bulk& inputs, T_Bulk& outputs, T_Step&& step, size_t batch = 64) {
+        if (VL_UNLIKELY(inputs.bytes() != stimBytes())) {
+            VL_FATAL_MT(__FILE__, __LINE__, "",
+                        "VerilatedCosimChannel::serve inputs size does not match stimulus record");
+            return 0;
+        }
+        if (VL_UNLIKELY(outputs.bytes() != respBytes())) {
+            VL_FATAL_MT(__FILE__, __LINE__, "",
+                        "VerilatedCosimChannel::serve outputs size does not match response "
+                        "record");
+            return 0;
+        }
+        batch = std::max<size_t>(1, std::min(batch, depth()));
+        std::vector<uint8_t> stim(batch * stimBytes());
+        std::vector<uint8_t> resp(batch * respBytes());
+        uint64_t served = 0;
+        int spins = 0;
+        while (true) {
+            const size_t n = pullStimulus(stim.data(), batch);
+            if (!n) {
+                if (closed()) break;
+                pause(spins);
+                continue;
+            }
+            spins = 0;
+            for (size_t i = 0; i < n; ++i) {
+                if (VL_UNLIKELY(!inputs.put(stim.data() + i * stimBytes()))) {
+                    VL_FATAL_MT(__FILE__, __LINE__, "",
+                                "VerilatedCosimChannel::serve inputs are not all writable");
+                    return served;
+                }
+                step();
+                outputs.get(resp.data() + i * respBytes());
+            }
+            pushResponsesAll(resp.data(), n);
+            served += n;
+        }
+        return served;
+    }
+
+private:
+    static std::string shmName(const std::string& name) {
+        return (name.empty() || name[0] != '/') ? "/" + name : name;
+    }
+    static size_t strideOf(size_t bytes) { return (bytes + 7) & ~static_cast<size_t>(7); }
+    static size_t mapSize(size_t depth, size_t stimBytes, size_t respBytes) {
+        return sizeof(Header) + depth * (strideOf(stimBytes) + strideOf(respBytes));
+    }
+    bool map(int fd, size_t size) {
+        void* const basep = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (basep == MAP_FAILED) return false;
+        m_headerp = static_cast<Header*>(basep);
+        m_size = size;
+        return true;
+    }
+    void setupRings() {
+        Header* const hp = m_headerp;
+        uint8_t* const recordsp = reinterpret_cast<uint8_t*>(hp) + sizeof(Header);
+        m_stim.m_indicesp = &hp->m_stim;
+        m_stim.m_recordsp = recordsp;
+        m_stim.m_bytes = hp->m_stimBytes;
+        m_stim.m_stride = strideOf(hp->m_stimBytes);
+        m_stim.m_mask = hp->m_depth - 1;
+        m_resp.m_indicesp = &hp->m_resp;
+        m_resp.m_recordsp = recordsp + hp->m_depth * m_stim.m_stride;
+        m_resp.m_bytes = hp->m_respBytes;
+        m_resp.m_stride = strideOf(hp->m_respBytes);
+        m_resp.m_mask = hp->m_depth - 1;
+        // Model side pulls stimulus and pushes responses, client the reverse
+        m_stim.m_otherIndex = m_model ? hp->m_stim.m_head.load() : hp->m_stim.m_tail.load();
+        m_resp.m_otherIndex = m_model ? hp->m_resp.m_tail.load() : hp->m_resp.m_head.load();
+    }
+    // Wait a little, briefly spinning before yielding to other processes
+    static void pause(int& spins) {
+        if (++spins < SPINS_BEFORE_YIELD) {
+            VL_CPU_RELAX();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    template <typename T_Func>
+    static void transferAll(size_t count, T_Func&& transfer) {
+        size_t done = 0;
+        int spins = 0;
+        while (done < count) {
+            const size_t n = transfer(done, count - done);
+            if (n) {
+                done += n;
+                spins = 0;
+            } else {
+                pause(spins);
+            }
+        }
+    }
+};
+
+#endif  // Guard
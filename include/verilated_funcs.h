@@ -475,14 +475,15 @@ static inline void VL_ASSIGNBIT_WO(int bit, WDataOutP owp) VL_MT_SAFE {
     { (od) = ((svar).read().get_word(0)) & VL_MASK_I(obits); }
 #define VL_ASSIGN_QSW(obits, od, svar) \
     { \
-        (od) = ((static_cast<QData>((svar).read().get_word(1))) << VL_IDATASIZE \
-                | (svar).read().get_word(0)) \
+        const auto& _svval = (svar).read(); \
+        (od) = ((static_cast<QData>(_svval.get_word(1))) << VL_IDATASIZE | _svval.get_word(0)) \
                & VL_MASK_Q(obits); \
     }
 #define VL_ASSIGN_WSW(obits, owp, svar) \
     { \
         const int words = VL_WORDS_I(obits); \
-        for (int i = 0; i < words; ++i) (owp)[i] = (svar).read().get_word(i); \
+        const auto& _svval = (svar).read(); \
+        for (int i = 0; i < words; ++i) (owp)[i] = _svval.get_word(i); \
         (owp)[words - 1] &= VL_MASK_E(obits); \
     }
 
@@ -648,6 +649,36 @@ static inline WDataOutP VL_EXTENDS_WW(int obits, int lbits, WDataOutP owp,
     return VL_MEMCPY_W(owp, lwp, lwords - 1);
 }
 
+//===================================================================
+// 64-bit limb access
+// Wide operations that carry between words (or that benefit from 64-bit
+// instructions) process pairs of EData words as one QData limb, halving
+// the loop trip count.
+
+// Number of full limbs in 'words'; an odd last word is handled separately
+#define VL_LIMBS_W(words) ((words) / 2)
+
+static inline QData _vl_limb_get(WDataInP const lwp, int limb) VL_PURE {
+    return static_cast<QData>(lwp[limb * 2]) | (static_cast<QData>(lwp[limb * 2 + 1]) << 32ULL);
+}
+static inline void _vl_limb_set(WDataOutP owp, int limb, QData value) VL_MT_SAFE {
+    owp[limb * 2] = static_cast<EData>(value);
+    owp[limb * 2 + 1] = static_cast<EData>(value >> 32ULL);
+}
+// As above, but a limb may be a lone last word
+static inline QData _vl_limb_get_partial(int words, WDataInP const lwp, int limb) VL_PURE {
+    if (limb * 2 + 1 < words) return _vl_limb_get(lwp, limb);
+    return lwp[limb * 2];
+}
+static inline void _vl_limb_set_partial(int words, WDataOutP owp, int limb,
+                                        QData value) VL_MT_SAFE {
+    if (limb * 2 + 1 < words) {
+        _vl_limb_set(owp, limb, value);
+    } else {
+        owp[limb * 2] = static_cast<EData>(value);
+    }
+}
+
 //===================================================================
 // REDUCTION OPERATORS
 
@@ -734,9 +765,10 @@ static inline IData VL_REDXOR_64(QData r) VL_PURE {
 #endif
 }
 static inline IData VL_REDXOR_W(int words, WDataInP const lwp) VL_PURE {
-    EData r = lwp[0];
-    for (int i = 1; i < words; ++i) r ^= lwp[i];
-    return VL_REDXOR_32(r);
+    QData r = 0;
+    for (int limb = 0; limb < VL_LIMBS_W(words); ++limb) r ^= _vl_limb_get(lwp, limb);
+    if (words & 1) r ^= lwp[words - 1];
+    return VL_REDXOR_64(r);
 }
 
 // EMIT_RULE: VL_COUNTONES_II:  oclean = false; lhs clean
@@ -753,9 +785,19 @@ static inline IData VL_COUNTONES_Q(QData lhs) VL_PURE {
 }
 #define VL_COUNTONES_E VL_COUNTONES_I
 static inline IData VL_COUNTONES_W(int words, WDataInP const lwp) VL_PURE {
+#if defined(__POPCNT__) && !defined(VL_NO_BUILTINS)
+    // With a hardware population count instruction, count whole limbs
+    IData r = 0;
+    for (int limb = 0; limb < VL_LIMBS_W(words); ++limb) {
+        r += __builtin_popcountll(_vl_limb_get(lwp, limb));
+    }
+    if (words & 1) r += __builtin_popcount(lwp[words - 1]);
+    return r;
+#else
     EData r = 0;
     for (int i = 0; i < words; ++i) r += VL_COUNTONES_E(lwp[i]);
     return r;
+#endif
 }
 
 // EMIT_RULE: VL_COUNTBITS_II:  oclean = false; lhs clean
@@ -921,9 +963,15 @@ static inline IData VL_EQ_W(int words, WDataInP const lwp, WDataInP const rwp) V
 
 // Internal usage
 static inline int _vl_cmp_w(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
-    for (int i = words - 1; i >= 0; --i) {
-        if (lwp[i] > rwp[i]) return 1;
-        if (lwp[i] < rwp[i]) return -1;
+    if (words & 1) {
+        const EData lhs = lwp[words - 1];
+        const EData rhs = rwp[words - 1];
+        if (lhs != rhs) return lhs > rhs ? 1 : -1;
+    }
+    for (int limb = VL_LIMBS_W(words) - 1; limb >= 0; --limb) {
+        const QData lhs = _vl_limb_get(lwp, limb);
+        const QData rhs = _vl_limb_get(rwp, limb);
+        if (lhs != rhs) return lhs > rhs ? 1 : -1;
     }
     return 0;  // ==
 }
@@ -999,20 +1047,18 @@ static inline int _vl_cmps_w(int lbits, WDataInP const lwp, WDataInP const rwp)
 
 // Output NOT clean
 static inline WDataOutP VL_NEGATE_W(int words, WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
-    EData carry = 1;
-    for (int i = 0; i < words; ++i) {
-        owp[i] = ~lwp[i] + carry;
-        carry = (owp[i] < ~lwp[i]);
-    }
+    QData carry = 1;
+    for (int limb = 0; limb < VL_LIMBS_W(words); ++limb) {
+        const QData inverted = ~_vl_limb_get(lwp, limb);
+        const QData result = inverted + carry;
+        carry = (result < inverted);
+        _vl_limb_set(owp, limb, result);
+    }
+    if (words & 1) owp[words - 1] = ~lwp[words - 1] + static_cast<EData>(carry);
     return owp;
 }
 static inline void VL_NEGATE_INPLACE_W(int words, WDataOutP owp_lwp) VL_MT_SAFE {
-    EData carry = 1;
-    for (int i = 0; i < words; ++i) {
-        const EData word = ~owp_lwp[i] + carry;
-        carry = (word < ~owp_lwp[i]);
-        owp_lwp[i] = word;
-    }
+    VL_NEGATE_W(words, owp_lwp, owp_lwp);
 }
 
 // EMIT_RULE: VL_MUL:    oclean=dirty; lclean==clean; rclean==clean;
@@ -1036,25 +1082,30 @@ static inline QData VL_MODDIV_QQQ(int lbits, QData lhs, QData rhs) {
 static inline WDataOutP VL_ADD_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
     QData carry = 0;
-    for (int i = 0; i < words; ++i) {
-        carry = carry + static_cast<QData>(lwp[i]) + static_cast<QData>(rwp[i]);
-        owp[i] = (carry & 0xffffffffULL);
-        carry = (carry >> 32ULL) & 0xffffffffULL;
-    }
+    for (int limb = 0; limb < VL_LIMBS_W(words); ++limb) {
+        const QData lhs = _vl_limb_get(lwp, limb);
+        const QData sum = lhs + _vl_limb_get(rwp, limb);
+        const QData result = sum + carry;
+        carry = (sum < lhs) | (result < sum);
+        _vl_limb_set(owp, limb, result);
+    }
+    if (words & 1) owp[words - 1] = lwp[words - 1] + rwp[words - 1] + static_cast<EData>(carry);
     // Last output word is dirty
     return owp;
 }
 
 static inline WDataOutP VL_SUB_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
-    QData carry = 0;
-    for (int i = 0; i < words; ++i) {
-        carry = (carry + static_cast<QData>(lwp[i])
-                 + static_cast<QData>(static_cast<IData>(~rwp[i])));
-        if (i == 0) ++carry;  // Negation of rwp
-        owp[i] = (carry & 0xffffffffULL);
-        carry = (carry >> 32ULL) & 0xffffffffULL;
-    }
+    QData borrow = 0;
+    for (int limb = 0; limb < VL_LIMBS_W(words); ++limb) {
+        const QData lhs = _vl_limb_get(lwp, limb);
+        const QData rhs = _vl_limb_get(rwp, limb);
+        const QData diff = lhs - rhs;
+        const QData result = diff - borrow;
+        borrow = (lhs < rhs) | (diff < borrow);
+        _vl_limb_set(owp, limb, result);
+    }
+    if (words & 1) owp[words - 1] = lwp[words - 1] - rwp[words - 1] - static_cast<EData>(borrow);
     // Last output word is dirty
     return owp;
 }
@@ -1062,6 +1113,24 @@ static inline WDataOutP VL_SUB_W(int words, WDataOutP owp, WDataInP const lwp,
 static inline WDataOutP VL_MUL_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
     for (int i = 0; i < words; ++i) owp[i] = 0;
+#if defined(__SIZEOF_INT128__) && !defined(VL_NO_BUILTINS)
+    // Schoolbook multiply on 64-bit limbs, using 64x64->128 bit multiplies
+    __extension__ using VlMulData = unsigned __int128;
+    const int limbs = (words + 1) / 2;
+    for (int llimb = 0; llimb < limbs; ++llimb) {
+        const QData lhs = _vl_limb_get_partial(words, lwp, llimb);
+        if (!lhs) continue;
+        QData carry = 0;
+        for (int rlimb = 0; llimb + rlimb < limbs; ++rlimb) {
+            const int olimb = llimb + rlimb;
+            const VlMulData mul
+                = static_cast<VlMulData>(lhs) * _vl_limb_get_partial(words, rwp, rlimb)
+                  + _vl_limb_get_partial(words, owp, olimb) + carry;
+            _vl_limb_set_partial(words, owp, olimb, static_cast<QData>(mul));
+            carry = static_cast<QData>(mul >> 64);
+        }
+    }
+#else
     for (int lword = 0; lword < words; ++lword) {
         for (int rword = 0; rword < words; ++rword) {
             QData mul = static_cast<QData>(lwp[lword]) * static_cast<QData>(rwp[rword]);
@@ -1072,6 +1141,7 @@ static inline WDataOutP VL_MUL_W(int words, WDataOutP owp, WDataInP const lwp,
             }
         }
     }
+#endif
     // Last output word is dirty
     return owp;
 }
@@ -1931,8 +2001,14 @@ static inline WDataOutP VL_SHIFTL_WWI(int obits, int, int, WDataOutP owp, WDataI
         for (int i = 0; i < word_shift; ++i) owp[i] = 0;
         for (int i = word_shift; i < VL_WORDS_I(obits); ++i) owp[i] = lwp[i - word_shift];
     } else {
-        for (int i = 0; i < VL_WORDS_I(obits); ++i) owp[i] = 0;
-        _vl_insert_WW(owp, lwp, obits - 1, rd);
+        const int nbitsfromlower = VL_EDATASIZE - bit_shift;
+        for (int i = VL_WORDS_I(obits) - 1; i > word_shift; --i) {
+            owp[i] = (lwp[i - word_shift] << bit_shift)
+                     | (lwp[i - word_shift - 1] >> nbitsfromlower);
+        }
+        owp[word_shift] = lwp[0] << bit_shift;
+        for (int i = 0; i < word_shift; ++i) owp[i] = 0;
+        owp[VL_WORDS_I(obits) - 1] &= VL_MASK_E(obits);
     }
     return owp;
 }
@@ -2780,6 +2856,15 @@ static inline WDataOutP VL_COND_WIWW(int obits, WDataOutP owp, int cond, WDataIn
     return VL_MEMCPY_W(owp, cond ? w1p : w2p, VL_WORDS_I(obits));
 }
 
+// Branch free conditionals, used with -fbranchless; both operands are always evaluated
+// 'cond' must be clean (0/1), output is clean if both operands are clean
+static inline IData VL_CONDMASK_I(IData cond, IData lhs, IData rhs) VL_PURE {
+    return rhs ^ ((lhs ^ rhs) & (VL_UL(0) - cond));
+}
+static inline QData VL_CONDMASK_Q(IData cond, QData lhs, QData rhs) VL_PURE {
+    return rhs ^ ((lhs ^ rhs) & (0ULL - static_cast<QData>(cond)));
+}
+
 //======================================================================
 // Constification
 
@@ -2988,6 +3073,38 @@ extern void VL_READMEM_N(bool hex, int bits, QData depth, int array_lsb,
 extern void VL_WRITEMEM_N(bool hex, int bits, QData depth, int array_lsb,
                           const std::string& filename, const void* memp, QData start,
                           QData end) VL_MT_SAFE;
+// Sparse array versions, only touching rows present in the file, or allocated
+template <typename T_Value, std::size_t N_Depth>
+void VL_READMEM_N(bool hex, int bits, QData depth, int array_lsb, const std::string& filename,
+                  VlSparseUnpacked<T_Value, N_Depth>* memp, QData start, QData end) VL_MT_SAFE {
+    if (start < static_cast<QData>(array_lsb)) start = array_lsb;
+    VlReadMem rmem{hex, bits, filename, start, end};
+    if (VL_UNLIKELY(!rmem.isOpen())) return;
+    QData addr = 0;
+    std::string value;
+    while (rmem.get(addr /*ref*/, value /*ref*/)) {
+        if (VL_UNLIKELY(addr < static_cast<QData>(array_lsb)
+                        || addr >= static_cast<QData>(array_lsb + depth))) {
+            VL_FATAL_MT(filename.c_str(), rmem.linenum(), "",
+                        "$readmem file address beyond bounds of array");
+        } else {
+            rmem.setData(&(*memp)[addr - array_lsb], value);
+        }
+    }
+}
+template <typename T_Value, std::size_t N_Depth>
+void VL_WRITEMEM_N(bool hex, int bits, QData depth, int array_lsb, const std::string& filename,
+                   const VlSparseUnpacked<T_Value, N_Depth>* memp, QData start,
+                   QData end) VL_MT_SAFE {
+    const QData addr_max = array_lsb + depth - 1;
+    if (start < static_cast<QData>(array_lsb)) start = array_lsb;
+    if (end > addr_max) end = addr_max;
+    VlWriteMem wmem{hex, bits, filename, start, end};
+    if (VL_UNLIKELY(!wmem.isOpen())) return;
+    for (QData addr = start; addr <= end; ++addr) {
+        wmem.print(addr, false, &(*memp)[addr - array_lsb]);
+    }
+}
 extern IData VL_SSCANF_INNX(int lbits, const std::string& ld, const std::string& format, int argc,
                             ...) VL_MT_SAFE;
 extern void VL_SFORMAT_NX(int obits_ignored, std::string& output, const std::string& format,
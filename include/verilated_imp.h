@@ -433,6 +433,9 @@ protected:
     ExportNameMap m_exportMap VL_GUARDED_BY(m_exportMutex);
     int m_exportNext VL_GUARDED_BY(m_exportMutex) = 0;  // Next export funcnum
 
+    // Incremented when any scope or variable is added or removed, in any context
+    std::atomic<uint64_t> m_namesGeneration{0};
+
     // CONSTRUCTORS
     VerilatedImpData() = default;
 };
@@ -481,6 +484,12 @@ public:
         return it->second;
     }
 
+    // METHODS - scope and variable names
+    // Generation changes whenever names are added or removed, so caches of
+    // name lookups can tell when they are stale
+    static uint64_t namesGeneration() VL_MT_SAFE { return s().m_namesGeneration; }
+    static void namesChanged() VL_MT_SAFE { ++s().m_namesGeneration; }
+
     // METHODS - But only for verilated.cpp
 
     // Symbol table destruction cleans up the entries for each scope.
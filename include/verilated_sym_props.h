@@ -255,6 +255,7 @@ class VerilatedVar final : public VerilatedVarProps {
     // MEMBERS
     void* const m_datap;  // Location of data
     const char* const m_namep;  // Name - slowpath
+    uint8_t* m_changedp = nullptr;  // Set by model when value may have changed, or nullptr
 protected:
     const bool m_isParam;
     friend class VerilatedScope;
@@ -272,6 +273,8 @@ public:
     void* datap() const { return m_datap; }
     const char* name() const { return m_namep; }
     bool isParam() const { return m_isParam; }
+    // Flag the model sets when it writes the variable (--vpi-change-flags), or nullptr
+    uint8_t* changedp() const { return m_changedp; }
 };
 
 #endif  // Guard
@@ -46,21 +46,101 @@ struct VerilatedCStrCmp final {
     bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) < 0; }
 };
 
+// Class to hash const char*'s by contents (FNV-1a)
+struct VerilatedCStrHash final {
+    size_t operator()(const char* s) const {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (; *s; ++s) hash = (hash ^ static_cast<uint8_t>(*s)) * 0x100000001b3ULL;
+        return static_cast<size_t>(hash);
+    }
+};
+struct VerilatedCStrEq final {
+    bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) == 0; }
+};
+
 // Map of sorted scope names to find associated scope class
 // This is a class instead of typedef/using to allow forward declaration in verilated.h
+// Iteration is in sorted order, lookups by name use a hashed index into the map's nodes, so the
+// map may only be modified through scopeInsert and scopeErase.
 class VerilatedScopeNameMap final
-    : public std::map<const char*, const VerilatedScope*, VerilatedCStrCmp> {
+    : private std::map<const char*, const VerilatedScope*, VerilatedCStrCmp> {
+    using Base = std::map<const char*, const VerilatedScope*, VerilatedCStrCmp>;
+    std::unordered_map<const char*, const VerilatedScope*, VerilatedCStrHash, VerilatedCStrEq>
+        m_index;  // Hashed index of map, points into nodes of Base
+    VL_UNCOPYABLE(VerilatedScopeNameMap);
+
 public:
+    using typename Base::const_iterator;
+    using typename Base::iterator;
+    using typename Base::key_type;
+    using typename Base::mapped_type;
+    using typename Base::size_type;
+    using typename Base::value_type;
     VerilatedScopeNameMap() = default;
     ~VerilatedScopeNameMap() = default;
+    // METHODS
+    using Base::begin;
+    using Base::cbegin;
+    using Base::cend;
+    using Base::count;
+    using Base::empty;
+    using Base::end;
+    using Base::size;
+    const_iterator find(const char* namep) const { return Base::find(namep); }
+    const VerilatedScope* scopeFind(const char* namep) const {
+        const auto it = m_index.find(namep);
+        return VL_LIKELY(it != m_index.end()) ? it->second : nullptr;
+    }
+    void scopeInsert(const char* namep, const VerilatedScope* scopep) {
+        if (emplace(namep, scopep).second) m_index.emplace(namep, scopep);
+    }
+    void scopeErase(const char* namep) {
+        const auto it = Base::find(namep);
+        if (it == end()) return;
+        m_index.erase(it->first);
+        erase(it);
+    }
 };
 
 // Map of sorted variable names to find associated variable class
 // This is a class instead of typedef/using to allow forward declaration in verilated.h
-class VerilatedVarNameMap final : public std::map<const char*, VerilatedVar, VerilatedCStrCmp> {
+// Iteration is in sorted order, lookups by name use a hashed index into the map's nodes, so the
+// map may only be modified through varInsert, or the insert and erase below.
+class VerilatedVarNameMap final : private std::map<const char*, VerilatedVar, VerilatedCStrCmp> {
+    using Base = std::map<const char*, VerilatedVar, VerilatedCStrCmp>;
+    std::unordered_map<const char*, VerilatedVar*, VerilatedCStrHash, VerilatedCStrEq>
+        m_index;  // Hashed index of map, points into nodes of Base
+    VL_UNCOPYABLE(VerilatedVarNameMap);
+
 public:
+    using typename Base::const_iterator;
+    using typename Base::iterator;
+    using typename Base::key_type;
+    using typename Base::mapped_type;
+    using typename Base::size_type;
+    using typename Base::value_type;
     VerilatedVarNameMap() = default;
     ~VerilatedVarNameMap() = default;
+    // METHODS
+    using Base::begin;
+    using Base::cbegin;
+    using Base::cend;
+    using Base::count;
+    using Base::empty;
+    using Base::end;
+    using Base::find;
+    using Base::size;
+    VerilatedVar* varFind(const char* namep) const {
+        const auto it = m_index.find(namep);
+        return VL_LIKELY(it != m_index.end()) ? it->second : nullptr;
+    }
+    void varInsert(const char* namep, const VerilatedVar& var) {
+        const auto pair = emplace(namep, var);
+        if (pair.second) m_index.emplace(pair.first->first, &pair.first->second);
+    }
+    // Insert or erase a variable after model construction, e.g. by user code
+    std::pair<iterator, bool> insert(const value_type& value) VL_MT_UNSAFE;
+    iterator erase(const_iterator it) VL_MT_UNSAFE;
 };
 
 // Map of parent scope to vector of children scopes
@@ -330,14 +330,19 @@ class VlReadMem final {
     const int m_bits;  // Bit width of values
     const std::string& m_filename;  // Filename
     const QData m_end;  // End address (as specified by user)
-    FILE* m_fp = nullptr;  // File handle for filename
+    const char* m_datap = nullptr;  // File contents, nullptr if not open
+    const char* m_cp = nullptr;  // Next character to parse
+    const char* m_endp = nullptr;  // End of file contents
+    size_t m_mapSize = 0;  // Size of memory mapping, or 0 if contents in m_buffer
+    std::string m_buffer;  // File contents, if not memory mapped
     QData m_addr = 0;  // Next address to read
     int m_linenum = 0;  // Line number last read from file
     bool m_anyAddr = false;  // Had address directive in the file
 public:
     VlReadMem(bool hex, int bits, const std::string& filename, QData start, QData end);
     ~VlReadMem();
-    bool isOpen() const { return m_fp != nullptr; }
+    VL_UNCOPYABLE(VlReadMem);
+    bool isOpen() const { return m_datap != nullptr; }
     int linenum() const { return m_linenum; }
     bool get(QData& addrr, std::string& valuer);
     void setData(void* valuep, const std::string& rhs);
@@ -1626,6 +1631,93 @@ std::string VL_TO_STRING(const VlUnpacked<T_Value, N_Depth>& obj) {
 template <typename T_Value, std::size_t N_Depth>
 struct VlContainsCustomStruct<VlUnpacked<T_Value, N_Depth>> : VlContainsCustomStruct<T_Value> {};
 
+//===================================================================
+/// Verilog unpacked array container, with storage allocated on demand
+///
+/// Used in place of VlUnpacked for large one dimensional arrays where
+/// typically only a small part of the array is ever accessed, e.g.
+/// memory models. Elements are held in fixed size pages, each allocated
+/// and zeroed when an element within it is first written. Reading through
+/// a const reference never allocates.
+
+// Log2 of number of elements per page, so a page is at most 4 KiB
+constexpr int vlSparsePageBits(std::size_t elemBytes, int bits = 12) {
+    return (bits > 0 && (elemBytes << bits) > 4096) ? vlSparsePageBits(elemBytes, bits - 1)
+                                                    : bits;
+}
+
+template <typename T_Value, std::size_t N_Depth>
+class VlSparseUnpacked final {
+    // CONSTANTS
+    static constexpr int PAGE_BITS = vlSparsePageBits(sizeof(T_Value));
+    static constexpr std::size_t PAGE_SIZE = static_cast<std::size_t>(1) << PAGE_BITS;
+    static constexpr std::size_t PAGE_MASK = PAGE_SIZE - 1;
+    static constexpr std::size_t N_PAGES = (N_Depth + PAGE_MASK) >> PAGE_BITS;
+
+    // MEMBERS
+    // Page table, nullptr for pages not yet allocated. Atomic as different
+    // threads may concurrently access different elements of the same page.
+    std::unique_ptr<std::atomic<T_Value*>[]> m_pagesp{new std::atomic<T_Value*>[N_PAGES]};
+    std::atomic<std::size_t> m_allocated{0};  // Number of allocated pages
+
+public:
+    // CONSTRUCTORS
+    VlSparseUnpacked() {
+        for (std::size_t i = 0; i < N_PAGES; ++i) m_pagesp[i].store(nullptr);
+    }
+    ~VlSparseUnpacked() { clear(); }
+    VL_UNCOPYABLE(VlSparseUnpacked);
+    VL_UNMOVABLE(VlSparseUnpacked);
+
+    // METHODS
+    static constexpr std::size_t size() { return N_Depth; }
+    // Number of pages with allocated storage
+    std::size_t allocatedPages() const { return m_allocated.load(); }
+    // Bytes of element storage allocated
+    std::size_t allocatedBytes() const { return allocatedPages() * PAGE_SIZE * sizeof(T_Value); }
+    // Release all storage, so all elements are zero
+    void clear() {
+        for (std::size_t i = 0; i < N_PAGES; ++i) delete[] m_pagesp[i].exchange(nullptr);
+        m_allocated.store(0);
+    }
+
+    // Return reference to element, allocating its page if needed
+    T_Value& operator[](std::size_t index) {
+        T_Value* pagep = m_pagesp[index >> PAGE_BITS].load(std::memory_order_acquire);
+        if (VL_UNLIKELY(!pagep)) pagep = allocatePage(index >> PAGE_BITS);
+        return pagep[index & PAGE_MASK];
+    }
+    // Return element value, or zero if its page was never allocated
+    const T_Value& read(std::size_t index) const {
+        const T_Value* const pagep
+            = m_pagesp[index >> PAGE_BITS].load(std::memory_order_acquire);
+        if (VL_UNLIKELY(!pagep)) return zero();
+        return pagep[index & PAGE_MASK];
+    }
+    const T_Value& operator[](std::size_t index) const { return read(index); }
+
+private:
+    VL_ATTR_NOINLINE T_Value* allocatePage(std::size_t page) {
+        T_Value* const newp = new T_Value[PAGE_SIZE]();
+        T_Value* expected = nullptr;
+        if (!m_pagesp[page].compare_exchange_strong(expected, newp, std::memory_order_acq_rel)) {
+            // Another thread won the race
+            delete[] newp;
+            return expected;
+        }
+        ++m_allocated;
+        return newp;
+    }
+    static const T_Value& zero() {
+        static const T_Value s_zero{};
+        return s_zero;
+    }
+};
+
+template <typename T_Value, std::size_t N_Depth>
+struct VlContainsCustomStruct<VlSparseUnpacked<T_Value, N_Depth>>
+    : VlContainsCustomStruct<T_Value> {};
+
 template <typename T_Value, size_t N_MaxSize>
 template <typename T_UnpackedValue, std::size_t N_UnpackedDepth>
 void VlQueue<T_Value, N_MaxSize>::renew_copy(
@@ -33,12 +33,14 @@
 
 #include "vltstd/vpi_user.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
 #include <list>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -359,6 +361,7 @@ public:
 
 class VerilatedVpioVar VL_NOT_FINAL : public VerilatedVpioVarBase {
     uint8_t* m_prevDatap = nullptr;  // Previous value of data, for cbValueChange
+    bool m_maybeChanged = true;  // Change flag snapshot, for cbValueChange
     union {
         uint8_t u8[4];
         uint32_t u32;
@@ -439,6 +442,11 @@ public:
         return t_out.c_str();
     }
     void* prevDatap() const { return m_prevDatap; }
+    bool maybeChanged() const { return m_maybeChanged; }
+    void snapshotChanged() {
+        const uint8_t* const changedp = varp()->changedp();
+        m_maybeChanged = !changedp || *changedp;
+    }
     void* varDatap() const override { return m_varDatap; }
     void createPrevDatap() {
         if (VL_UNLIKELY(!m_prevDatap)) {
@@ -729,6 +737,7 @@ public:
     ~VerilatedVpiCbHolder() = default;
     VerilatedPliCb cb_rtnp() const { return m_cbData.cb_rtn; }
     s_cb_data* cb_datap() { return &m_cbData; }
+    VerilatedVpioVar* varop() { return &m_varo; }
     uint64_t id() const { return m_id; }
     bool invalid() const { return !m_id; }
     void invalidate() { m_id = 0; }
@@ -887,6 +896,13 @@ struct VerilatedVpiTimedCbsCmp final {
 class VerilatedVpiError;
 void vl_vpi_put_word(const VerilatedVpioVar* vop, QData word, size_t bitCount, size_t addOffset);
 
+// Result of a vpi_handle_by_name search
+struct VerilatedVpiNameFound final {
+    const VerilatedScope* m_scopep;  // Scope found, or scope of variable, nullptr if not found
+    const VerilatedVar* m_varp;  // Variable found, or nullptr if scope found
+};
+using VerilatedVpiNameCache = std::unordered_map<std::string, VerilatedVpiNameFound>;
+
 class VerilatedVpiImp final {
     enum { CB_ENUM_MAX_VALUE = cbAtEndOfSimTime + 1 };  // Maximum callback reason
     using VpioCbList = std::list<VerilatedVpiCbHolder>;
@@ -899,10 +915,14 @@ class VerilatedVpiImp final {
     VpioFutureCbs m_futureCbs;  // Time based callbacks for future timestamps
     VpioFutureCbs m_nextCbs;  // cbNextSimTime callbacks
     std::list<VerilatedVpiPutHolder> m_inertialPuts;  // Pending vpi puts due to vpiInertialDelay
+    std::vector<VerilatedVpiBulk*> m_bulkPuts;  // Pending VerilatedVpiBulk::putScheduled
     VerilatedVpiError* m_errorInfop = nullptr;  // Container for vpi error info
     VerilatedAssertOneThread m_assertOne;  // Assert only called from single thread
     uint64_t m_nextCallbackId = 1;  // Id to identify callback
     bool m_evalNeeded = false;  // Model has had signals updated via vpi_put_value()
+    VerilatedVpiNameCache m_nameCache;  // Results of vpi_handle_by_name
+    const VerilatedContext* m_nameCacheContextp = nullptr;  // Context m_nameCache is for
+    uint64_t m_nameCacheGeneration = 0;  // VerilatedImp::namesGeneration m_nameCache is for
 
     static VerilatedVpiImp& s() {  // Singleton
         static VerilatedVpiImp s_s;
@@ -912,6 +932,18 @@ class VerilatedVpiImp final {
 public:
     static void assertOneCheck() { s().m_assertOne.check(); }
     static uint64_t nextCallbackId() { return ++s().m_nextCallbackId; }
+    static VerilatedVpiNameCache& nameCache() {
+        // Discard if for a different context, or scopes or variables changed since made
+        const VerilatedContext* const contextp = Verilated::threadContextp();
+        const uint64_t generation = VerilatedImp::namesGeneration();
+        if (VL_UNLIKELY(contextp != s().m_nameCacheContextp
+                        || generation != s().m_nameCacheGeneration)) {
+            s().m_nameCache.clear();
+            s().m_nameCacheContextp = contextp;
+            s().m_nameCacheGeneration = generation;
+        }
+        return s().m_nameCache;
+    }
 
     static void cbCurrentAdd(uint64_t id, const s_cb_data* cb_data_p) {
         // The passed cb_data_p was property of the user, so need to recreate
@@ -1036,6 +1068,14 @@ public:
         std::set<VerilatedVpioVar*> update;  // set of objects to update after callbacks
         if (cbObjList.empty()) return called;
         const auto last = std::prev(cbObjList.end());  // prevent looping over newly added elements
+        // Variables with a model change flag need only be compared if the flag was set.
+        // Snapshot all flags before clearing any, as multiple callbacks may share a flag.
+        for (VerilatedVpiCbHolder& ho : cbObjList) {
+            if (VL_LIKELY(!ho.invalid())) ho.varop()->snapshotChanged();
+        }
+        for (VerilatedVpiCbHolder& ho : cbObjList) {
+            if (uint8_t* const changedp = ho.varop()->varp()->changedp()) *changedp = 0;
+        }
         for (auto it = cbObjList.begin(); true;) {
             // cbReasonRemove sets to nullptr, so we know on removal the old end() will still exist
             const bool was_last = it == last;
@@ -1045,8 +1085,11 @@ public:
                 continue;
             }
             VerilatedVpiCbHolder& ho = *it++;
-            VerilatedVpioVar* const varop
-                = reinterpret_cast<VerilatedVpioVar*>(ho.cb_datap()->obj);
+            VerilatedVpioVar* const varop = ho.varop();
+            if (!varop->maybeChanged()) {
+                if (was_last) break;
+                continue;
+            }
             void* const newDatap = varop->varDatap();
             void* const prevDatap = varop->prevDatap();  // Was malloced when we added the callback
             VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_test %s v[0]=%d/%d %p %p\n",
@@ -1080,6 +1123,18 @@ public:
             vpi_put_value(it.varp()->castVpiHandle(), it.valuep(), nullptr, vpiNoDelay);
         }
         s().m_inertialPuts.clear();
+        if (s().m_bulkPuts.empty()) return;
+        for (VerilatedVpiBulk* const bulkp : s().m_bulkPuts) {
+            bulkp->putNow(bulkp->m_scheduled.data());
+            bulkp->m_scheduled.clear();
+        }
+        s().m_bulkPuts.clear();
+        evalNeeded(true);
+    }
+    static void bulkPutSchedule(VerilatedVpiBulk* bulkp) { s().m_bulkPuts.push_back(bulkp); }
+    static void bulkPutUnschedule(VerilatedVpiBulk* bulkp) {
+        std::vector<VerilatedVpiBulk*>& puts = s().m_bulkPuts;
+        puts.erase(std::remove(puts.begin(), puts.end(), bulkp), puts.end());
     }
     static auto getForceControlSignals(const VerilatedVpioVarBase* vop);
 
@@ -1252,6 +1307,100 @@ bool VerilatedVpi::evalNeeded() VL_MT_UNSAFE_ONE { return VerilatedVpiImp::evalN
 
 void VerilatedVpi::doInertialPuts() VL_MT_UNSAFE_ONE { VerilatedVpiImp::doInertialPuts(); }
 
+//======================================================================
+// VerilatedVpiBulk implementation
+
+VerilatedVpiBulk::~VerilatedVpiBulk() {
+    if (!m_scheduled.empty()) VerilatedVpiImp::bulkPutUnschedule(this);
+}
+
+int VerilatedVpiBulk::add(vpiHandle object) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    const VerilatedVpioVar* const vop = VerilatedVpioVar::castp(object);
+    if (VL_UNLIKELY(!vop)) {
+        VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported vpiHandle (%p)", __func__, object);
+        return -1;
+    }
+    const VerilatedVar* const varp = vop->varp();
+    switch (varp->vltype()) {
+    case VLVT_UINT8:
+    case VLVT_UINT16:
+    case VLVT_UINT32:
+    case VLVT_UINT64:
+    case VLVT_WDATA: break;
+    default:
+        VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported type for '%s', must be integral",
+                      __func__, vop->fullname());
+        return -1;
+    }
+    // Must be a whole variable, or whole element of an unpacked array
+    if (VL_UNLIKELY(vop->indexedDim() + 1 != varp->udims())) {
+        VL_VPI_ERROR_(__FILE__, __LINE__,
+                      "%s: Unsupported handle '%s', must be a variable or unpacked array element",
+                      __func__, vop->fullname());
+        return -1;
+    }
+    if (VL_UNLIKELY(varp->isForceable())) {
+        VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported forceable signal '%s'", __func__,
+                      vop->fullname());
+        return -1;
+    }
+    const uint32_t bits = varp->entBits();
+    const uint32_t bytes = (bits + 7) / 8;
+    m_entries.push_back({static_cast<uint8_t*>(vop->varDatap()), varp->changedp(), m_bytes, bytes,
+                         static_cast<uint8_t>(VL_MASK_I(((bits - 1) & 7) + 1))});
+    m_bytes += bytes;
+    if (!varp->isPublicRW()) m_writable = false;
+    return static_cast<int>(m_entries.size() - 1);
+}
+
+void VerilatedVpiBulk::get(void* bufp) const VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    uint8_t* const outp = static_cast<uint8_t*>(bufp);
+    for (const Entry& entry : m_entries) {
+        std::memcpy(outp + entry.m_offset, entry.m_datap, entry.m_bytes);
+    }
+}
+
+void VerilatedVpiBulk::putNow(const uint8_t* bufp) VL_MT_UNSAFE_ONE {
+    for (const Entry& entry : m_entries) {
+        std::memcpy(entry.m_datap, bufp + entry.m_offset, entry.m_bytes);
+        entry.m_datap[entry.m_bytes - 1] &= entry.m_topMask;
+        if (entry.m_changedp) *entry.m_changedp = 1;
+    }
+}
+
+bool VerilatedVpiBulk::put(const void* bufp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    if (VL_UNLIKELY(!m_writable)) {
+        VL_VPI_ERROR_(__FILE__, __LINE__,
+                      "%s: Includes signal marked read-only, use public_flat_rw instead",
+                      __func__);
+        return false;
+    }
+    putNow(static_cast<const uint8_t*>(bufp));
+    VerilatedVpiImp::evalNeeded(true);
+    return true;
+}
+
+bool VerilatedVpiBulk::putScheduled(const void* bufp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    if (VL_UNLIKELY(!m_writable)) {
+        VL_VPI_ERROR_(__FILE__, __LINE__,
+                      "%s: Includes signal marked read-only, use public_flat_rw instead",
+                      __func__);
+        return false;
+    }
+    if (!m_bytes) return true;
+    if (m_scheduled.empty()) VerilatedVpiImp::bulkPutSchedule(this);
+    const uint8_t* const inp = static_cast<const uint8_t*>(bufp);
+    m_scheduled.assign(inp, inp + m_bytes);
+    return true;
+}
+
 //======================================================================
 // VerilatedVpiImp implementation
 
@@ -2175,13 +2324,62 @@ void vpi_get_systf_info(vpiHandle /*object*/, p_vpi_systf_data /*systf_data_p*/)
 
 // for obtaining handles
 
+// Find scope, or variable and its scope, of hierarchical name, without caching
+static VerilatedVpiNameFound vl_vpi_find_by_name(const std::string& scopeAndName) {
+    // This doesn't yet follow the hierarchy in the proper way
+    bool isPackage = false;
+    const VerilatedScope* scopep
+        = Verilated::threadContextp()->scopeFind(scopeAndName.c_str());
+    if (scopep) return {scopep, nullptr};  // Whole thing found as a scope
+    std::string basename = scopeAndName;
+    std::string scopename;
+    std::string::size_type prevpos = std::string::npos;
+    std::string::size_type pos = std::string::npos;
+    // Split hierarchical names at last '.' not inside escaped identifier
+    size_t i = 0;
+    while (i < scopeAndName.length()) {
+        if (scopeAndName[i] == '\\') {
+            while (i < scopeAndName.length() && scopeAndName[i] != ' ') ++i;
+            ++i;  // Proc ' ', it should always be there. Then grab '.' on next cycle
+        } else {
+            while (i < scopeAndName.length()
+                   && (scopeAndName[i] != '.'
+                       && (i + 1 >= scopeAndName.length() || scopeAndName[i] != ':'
+                           || scopeAndName[i + 1] != ':')))
+                ++i;
+            if (i < scopeAndName.length()) {
+                prevpos = pos;
+                pos = i++;
+                if (scopeAndName[i - 1] == ':') isPackage = true;
+            }
+        }
+    }
+    // Do the split
+    if (VL_LIKELY(pos != std::string::npos)) {
+        basename.erase(0, pos + (isPackage ? 2 : 1));
+        scopename = scopeAndName.substr(0, pos);
+        if (scopename == "$unit") scopename = "\\$unit ";
+    }
+    const VerilatedVar* varp = nullptr;
+    if (prevpos == std::string::npos) {
+        // scopename is a toplevel (no '.' separator), so search in our TOP ports first.
+        scopep = Verilated::threadContextp()->scopeFind("TOP");
+        if (scopep) varp = scopep->varFind(basename.c_str());
+    }
+    if (!varp) {
+        scopep = Verilated::threadContextp()->scopeFind(scopename.c_str());
+        if (!scopep) return {nullptr, nullptr};
+        varp = scopep->varFind(basename.c_str());
+    }
+    if (!varp) return {nullptr, nullptr};
+    return {scopep, varp};
+}
+
 vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
     VerilatedVpiImp::assertOneCheck();
     VL_VPI_ERROR_RESET_();
     if (VL_UNLIKELY(!namep)) return nullptr;
     VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_handle_by_name %s %p\n", namep, scope););
-    const VerilatedVar* varp = nullptr;
-    const VerilatedScope* scopep;
     const VerilatedVpioScope* const voScopep = VerilatedVpioScope::castp(scope);
     std::string scopeAndName = namep;
     if (0 == std::strncmp(namep, "$root.", std::strlen("$root."))) {
@@ -2190,63 +2388,27 @@ vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
     } else if (voScopep) {
         const bool scopeIsPackage = VerilatedVpioPackage::castp(scope) != nullptr;
         scopeAndName = std::string{voScopep->fullname()} + (scopeIsPackage ? "" : ".") + namep;
-        namep = const_cast<PLI_BYTE8*>(scopeAndName.c_str());
-    }
-    {
-        // This doesn't yet follow the hierarchy in the proper way
-        bool isPackage = false;
-        scopep = Verilated::threadContextp()->scopeFind(namep);
-        if (scopep) {  // Whole thing found as a scope
-            if (scopep->type() == VerilatedScope::SCOPE_MODULE) {
-                return (new VerilatedVpioModule{scopep})->castVpiHandle();
-            } else if (scopep->type() == VerilatedScope::SCOPE_PACKAGE) {
-                return (new VerilatedVpioPackage{scopep})->castVpiHandle();
-            } else {
-                return (new VerilatedVpioScope{scopep})->castVpiHandle();
-            }
-        }
-        std::string basename = scopeAndName;
-        std::string scopename;
-        std::string::size_type prevpos = std::string::npos;
-        std::string::size_type pos = std::string::npos;
-        // Split hierarchical names at last '.' not inside escaped identifier
-        size_t i = 0;
-        while (i < scopeAndName.length()) {
-            if (scopeAndName[i] == '\\') {
-                while (i < scopeAndName.length() && scopeAndName[i] != ' ') ++i;
-                ++i;  // Proc ' ', it should always be there. Then grab '.' on next cycle
-            } else {
-                while (i < scopeAndName.length()
-                       && (scopeAndName[i] != '.'
-                           && (i + 1 >= scopeAndName.length() || scopeAndName[i] != ':'
-                               || scopeAndName[i + 1] != ':')))
-                    ++i;
-                if (i < scopeAndName.length()) {
-                    prevpos = pos;
-                    pos = i++;
-                    if (scopeAndName[i - 1] == ':') isPackage = true;
-                }
-            }
-        }
-        // Do the split
-        if (VL_LIKELY(pos != std::string::npos)) {
-            basename.erase(0, pos + (isPackage ? 2 : 1));
-            scopename = scopeAndName.substr(0, pos);
-            if (scopename == "$unit") scopename = "\\$unit ";
-        }
-        if (prevpos == std::string::npos) {
-            // scopename is a toplevel (no '.' separator), so search in our TOP ports first.
-            scopep = Verilated::threadContextp()->scopeFind("TOP");
-            if (scopep) varp = scopep->varFind(basename.c_str());
-        }
-        if (!varp) {
-            scopep = Verilated::threadContextp()->scopeFind(scopename.c_str());
-            if (!scopep) return nullptr;
-            varp = scopep->varFind(basename.c_str());
-        }
     }
-    if (!varp) return nullptr;
 
+    // Testbenches often look up the same names repeatedly, so cache results
+    VerilatedVpiNameCache& cache = VerilatedVpiImp::nameCache();
+    auto it = cache.find(scopeAndName);
+    if (it == cache.end()) {
+        it = cache.emplace(scopeAndName, vl_vpi_find_by_name(scopeAndName)).first;
+    }
+    const VerilatedScope* const scopep = it->second.m_scopep;
+    const VerilatedVar* const varp = it->second.m_varp;
+    if (!scopep) return nullptr;
+
+    if (!varp) {
+        if (scopep->type() == VerilatedScope::SCOPE_MODULE) {
+            return (new VerilatedVpioModule{scopep})->castVpiHandle();
+        } else if (scopep->type() == VerilatedScope::SCOPE_PACKAGE) {
+            return (new VerilatedVpioPackage{scopep})->castVpiHandle();
+        } else {
+            return (new VerilatedVpioScope{scopep})->castVpiHandle();
+        }
+    }
     if (varp->isParam()) {
         return (new VerilatedVpioParam{varp, scopep})->castVpiHandle();
     } else {
@@ -2972,6 +3134,7 @@ vpiHandle vpi_put_value(vpiHandle object, p_vpi_value valuep, p_vpi_time /*time_
             return object;
         }
         VerilatedVpiImp::evalNeeded(true);
+        if (uint8_t* const changedp = baseSignalVop->varp()->changedp()) *changedp = 1;
         const int varBits = baseSignalVop->bitSize();
 
         const auto forceControlSignals
@@ -34,6 +34,8 @@
 
 #include "vltstd/sv_vpi_user.h"
 
+#include <vector>
+
 //======================================================================
 
 /// Class for namespace-like grouping of Verilator VPI functions.
@@ -69,4 +71,67 @@ public:
     static void selfTest() VL_MT_UNSAFE_ONE;
 };
 
+//======================================================================
+/// Verilator-specific bulk access to the values of a set of signals.
+///
+/// Signal handles are added once, then get() reads the values of all of
+/// them into a buffer, and put() writes all of them from a buffer, each in
+/// a single call without per-signal s_vpi_value format conversion.
+///
+/// In the buffer, signals are in the order added, each taking
+/// byteSize(index) = (bits + 7) / 8 bytes starting at byteOffset(index),
+/// in the model's storage byte order, which is least significant byte
+/// first on little-endian hosts.
+
+class VerilatedVpiBulk final {
+    friend class VerilatedVpiImp;
+    // TYPES
+    struct Entry final {
+        uint8_t* m_datap;  // Variable storage
+        uint8_t* m_changedp;  // Variable's change flag (--vpi-change-flags), or nullptr
+        size_t m_offset;  // Offset in buffer
+        uint32_t m_bytes;  // Bytes in buffer
+        uint8_t m_topMask;  // Valid bits of most significant byte
+    };
+    // MEMBERS
+    std::vector<Entry> m_entries;  // Signals, in order added
+    std::vector<uint8_t> m_scheduled;  // Values for putScheduled, empty if none pending
+    size_t m_bytes = 0;  // Total buffer size
+    bool m_writable = true;  // All signals are public_rw
+
+public:
+    // CONSTRUCTORS
+    VerilatedVpiBulk() = default;
+    ~VerilatedVpiBulk();
+    VL_UNCOPYABLE(VerilatedVpiBulk);
+    VL_UNMOVABLE(VerilatedVpiBulk);
+
+    // METHODS
+    /// Add a signal, returning its index. Returns -1 and sets a VPI error if
+    /// the handle is not of an integral variable, or of an element of an
+    /// unpacked array of integrals, or is of a forceable variable.
+    int add(vpiHandle object) VL_MT_UNSAFE_ONE;
+    /// Number of signals
+    size_t size() const { return m_entries.size(); }
+    /// Size of buffer for get() and put(), in bytes
+    size_t bytes() const { return m_bytes; }
+    /// Offset of a signal's value in the buffer, in bytes
+    size_t byteOffset(size_t index) const { return m_entries[index].m_offset; }
+    /// Size of a signal's value in the buffer, in bytes
+    size_t byteSize(size_t index) const { return m_entries[index].m_bytes; }
+    /// Read values of all signals into bufp, which must be bytes() long
+    void get(void* bufp) const VL_MT_UNSAFE_ONE;
+    /// Write values of all signals from bufp, which must be bytes() long,
+    /// as if by vpi_put_value with vpiNoDelay. Returns false and sets a VPI
+    /// error if any signal is not public_rw.
+    bool put(const void* bufp) VL_MT_UNSAFE_ONE;
+    /// As with put(), but the values are written when
+    /// VerilatedVpi::doInertialPuts() is next called, that is before the
+    /// next evaluation. The buffer is copied, so may be reused immediately.
+    bool putScheduled(const void* bufp) VL_MT_UNSAFE_ONE;
+
+private:
+    void putNow(const uint8_t* bufp) VL_MT_UNSAFE_ONE;
+};
+
 #endif  // Guard
@@ -0,0 +1,235 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Skip combinational logic with unchanged inputs
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2003-2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3ActivityGate's Transformations:
+//
+// Only with --activity-gating. For each large combinational AstAlways:
+//      If the block is free of side effects, is the only writer of all the
+//      variables it assigns, and reads few simple variables relative to
+//      its size, wrap the body in a change detection check:
+//          if (!__VactGate__valid | (in1 != __VactGate__in1) | ...) {
+//              __VactGate__valid = 1;
+//              __VactGate__in1 = in1;
+//              ...
+//              <original body>
+//          }
+//      Variables written by the block are not inputs: as nothing else
+//      writes them, they can only change when the block itself executes.
+//      The shadow variables are ignored by scheduling, so the block is
+//      still ordered by, and only by, its original inputs.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3ActivityGate.h"
+
+#include "V3Stats.h"
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class ActivityGateVisitor final : public VNVisitor {
+    // NODE STATE
+    //  AstVarScope::user1p()   -> AstNode*: The only logic block writing this variable
+    //  AstVarScope::user2()    -> bool: Written by more than one logic block, or outside logic
+    //  AstVarScope::user3()    -> bool: Written by the current candidate (temporary)
+    //  AstVarScope::user4()    -> bool: Recorded as input of the current candidate (temporary)
+    const VNUser1InUse m_user1InUse;
+    const VNUser2InUse m_user2InUse;
+
+    // Only gate blocks with at least this many nodes
+    static constexpr int GATE_MIN_NODES = 64;
+    // Require at least this many nodes in the block per word of input compared
+    static constexpr int GATE_NODES_PER_WORD = 8;
+    // Never compare more than this many words of inputs
+    static constexpr int GATE_MAX_WORDS = 32;
+
+    // STATE - for current visit position (use VL_RESTORER)
+    AstScope* m_scopep = nullptr;  // Current scope
+
+    // STATE - across all visitors
+    size_t m_nGated = 0;  // Number of blocks gated, for unique names
+    VDouble0 m_statGated;  // Statistic tracking
+    VDouble0 m_statInputs;  // Statistic tracking
+
+    // METHODS
+    static void recordWriter(AstVarScope* vscp, AstNode* logicp) {
+        if (!vscp->user1p()) {
+            vscp->user1p(logicp);
+        } else if (vscp->user1p() != logicp) {
+            vscp->user2(true);
+        }
+    }
+
+    void gatherWriters(AstNetlist* netlistp) {
+        netlistp->foreach([](AstActive* activep) {
+            for (AstNode* logicp = activep->stmtsp(); logicp; logicp = logicp->nextp()) {
+                logicp->foreach([&](AstVarRef* refp) {
+                    if (refp->access().isWriteOrRW()) recordWriter(refp->varScopep(), logicp);
+                });
+            }
+        });
+        // Anything written from a function is considered to have multiple writers
+        netlistp->foreach([](AstCFunc* funcp) {
+            funcp->foreach([](AstVarRef* refp) {
+                if (refp->access().isWriteOrRW()) refp->varScopep()->user2(true);
+            });
+        });
+    }
+
+    static bool isGateableStmt(AstNode* nodep) {
+        if (AstNodeAssign* const assignp = VN_CAST(nodep, NodeAssign)) {
+            if (!VN_IS(assignp, Assign) && !VN_IS(assignp, AssignW)) return false;
+            return !assignp->timingControlp();
+        }
+        return VN_IS(nodep, If) || VN_IS(nodep, Comment);
+    }
+
+    // Returns true if the block can be gated, and fills 'inputs'
+    static bool isCandidate(AstAlways* alwaysp, std::vector<AstVarScope*>& inputs) {
+        if (alwaysp->sentreep()) return false;
+        const int nodes = alwaysp->nodeCount();
+        if (nodes < GATE_MIN_NODES) return false;
+        for (AstNode* stmtp = alwaysp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            if (!stmtp->gateTree()) return false;
+        }
+        // Must only contain simple statements and pure expressions
+        const bool impure = alwaysp->stmtsp()->exists([](AstNode* nodep) {
+            if (AstNodeExpr* const exprp = VN_CAST(nodep, NodeExpr)) return !exprp->isPure();
+            if (VN_IS(nodep, NodeStmt)) return !isGateableStmt(nodep);
+            return false;
+        });
+        if (impure) return false;
+        // Check written variables, which must only be written by this block
+        const VNUser3InUse user3InUse;
+        const bool badWrite = alwaysp->exists([&](const AstVarRef* refp) {
+            if (!refp->access().isWriteOrRW()) return false;
+            AstVarScope* const vscp = refp->varScopep();
+            const AstVar* const varp = vscp->varp();
+            vscp->user3(true);
+            return vscp->user2() || vscp->user1p() != alwaysp  //
+                   || varp->isSigUserRWPublic() || varp->isForced() || varp->isWrittenByDpi()
+                   || varp->isPrimaryInish();
+        });
+        if (badWrite) return false;
+        // Gather inputs, which must be simple values we can compare
+        const VNUser4InUse user4InUse;
+        int words = 0;
+        const bool badRead = alwaysp->exists([&](const AstVarRef* refp) {
+            if (!refp->access().isReadOrRW()) return false;
+            AstVarScope* const vscp = refp->varScopep();
+            if (vscp->user3() || vscp->user4()) return false;
+            vscp->user4(true);
+            if (!vscp->dtypep()->skipRefp()->isIntegralOrPacked()) return true;
+            inputs.push_back(vscp);
+            words += vscp->widthWords();
+            return words > GATE_MAX_WORDS;
+        });
+        if (badRead) return false;
+        return nodes >= GATE_NODES_PER_WORD * (words + 1);
+    }
+
+    void gate(AstAlways* alwaysp) {
+        std::vector<AstVarScope*> inputs;
+        if (!isCandidate(alwaysp, inputs)) return;
+        UINFO(4, "Activity gating " << alwaysp);
+        ++m_statGated;
+        m_statInputs += inputs.size();
+
+        FileLine* const flp = alwaysp->fileline();
+        const std::string prefix = "__VactGate" + cvtToStr(m_nGated++) + "__";
+        const auto newShadow = [&](const std::string& name, AstVarScope* vscp) {
+            AstVarScope* const shadowp = vscp ? m_scopep->createTempLike(prefix + name, vscp)
+                                              : m_scopep->createTemp(prefix + name, 1);
+            // Written only by the gated block itself, ignore so no UNOPTFLAT
+            shadowp->varp()->setIgnoreSchedWrite();
+            return shadowp;
+        };
+
+        // Build change detection condition, and the updates of the shadow copies
+        AstVarScope* const validp = newShadow("valid", nullptr);
+        AstNodeExpr* condp = new AstNot{flp, new AstVarRef{flp, validp, VAccess::READ}};
+        AstNode* const stmtsp = new AstAssign{flp, new AstVarRef{flp, validp, VAccess::WRITE},
+                                              new AstConst{flp, AstConst::BitTrue{}}};
+        for (AstVarScope* const vscp : inputs) {
+            AstVarScope* const shadowp = newShadow(vscp->varp()->name(), vscp);
+            AstNodeExpr* const neqp = new AstNeq{flp, new AstVarRef{flp, vscp, VAccess::READ},
+                                                 new AstVarRef{flp, shadowp, VAccess::READ}};
+            condp = new AstOr{flp, condp, neqp};
+            stmtsp->addNext(new AstAssign{flp, new AstVarRef{flp, shadowp, VAccess::WRITE},
+                                          new AstVarRef{flp, vscp, VAccess::READ}});
+        }
+
+        // Move original body under the condition
+        AstNode* bodyp = alwaysp->stmtsp()->unlinkFrBackWithNext();
+        if (alwaysp->keyword() == VAlwaysKwd::CONT_ASSIGN) {
+            // Continuous assignments become ordinary assignments in a combinational block
+            AstNode* const origp = bodyp;
+            bodyp = nullptr;
+            for (AstNode* nodep = origp; nodep; nodep = nodep->nextp()) {
+                AstAssignW* const assignWp = VN_CAST(nodep, AssignW);
+                if (!assignWp) continue;
+                bodyp = AstNode::addNext(
+                    bodyp, new AstAssign{assignWp->fileline(), assignWp->lhsp()->unlinkFrBack(),
+                                         assignWp->rhsp()->unlinkFrBack()});
+            }
+            VL_DO_DANGLING(origp->deleteTree(), origp);
+            AstAlways* const newp = new AstAlways{flp, VAlwaysKwd::ALWAYS_COMB, nullptr, nullptr};
+            alwaysp->replaceWith(newp);
+            VL_DO_DANGLING(pushDeletep(alwaysp), alwaysp);
+            alwaysp = newp;
+        }
+        stmtsp->addNext(bodyp);
+        alwaysp->addStmtsp(new AstIf{flp, condp, stmtsp});
+    }
+
+    // VISITORS
+    void visit(AstScope* nodep) override {
+        VL_RESTORER(m_scopep);
+        m_scopep = nodep;
+        iterateChildren(nodep);
+    }
+    void visit(AstActive* nodep) override {
+        if (!nodep->hasCombo()) return;
+        for (AstNode *logicp = nodep->stmtsp(), *nextp; logicp; logicp = nextp) {
+            nextp = logicp->nextp();
+            if (AstAlways* const alwaysp = VN_CAST(logicp, Always)) gate(alwaysp);
+        }
+    }
+    void visit(AstNodeExpr*) override {}  // Accelerate
+    void visit(AstNode* nodep) override { iterateChildren(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit ActivityGateVisitor(AstNetlist* nodep) {
+        gatherWriters(nodep);
+        iterate(nodep);
+    }
+    ~ActivityGateVisitor() override {
+        V3Stats::addStat("Optimizations, Activity gated blocks", m_statGated);
+        V3Stats::addStat("Optimizations, Activity gate inputs", m_statInputs);
+    }
+};
+
+//######################################################################
+// Activity gate class functions
+
+void V3ActivityGate::activityGateAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { ActivityGateVisitor{nodep}; }  // Destruct before checking
+    V3Global::dumpCheckGlobalTree("activitygate", 0, dumpTreeEitherLevel() >= 3);
+}
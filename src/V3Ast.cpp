@@ -49,6 +49,8 @@ bool VNUser4InUse::s_userBusy = false;
 
 int AstNodeDType::s_uniqueNum = 0;
 
+bool VNVisitorConst::s_countVisits = false;
+
 V3AST_VCMETHOD_ITEMDATA_DECL;
 
 //======================================================================
@@ -285,6 +285,7 @@ public:
 
 class VNVisitorConst VL_NOT_FINAL {
     friend class AstNode;
+    static bool s_countVisits;  // Count visit() dispatches, for --stats-timeline
 
 public:
     /// Call visit()s on nodep
@@ -300,6 +301,12 @@ public:
 
     virtual void visit(AstNode* nodep) = 0;
     virtual ~VNVisitorConst() {}
+
+    // For --stats-timeline, called by accept() before visit()
+    static bool countVisits() VL_MT_SAFE { return s_countVisits; }
+    static void countVisits(bool flag) { s_countVisits = flag; }
+    void countVisit(const AstNode* nodep) VL_MT_SAFE;  // Defined in V3StatsReport.cpp
+
 #include "V3Ast__gen_visitor_decls.h"  // From ./astgen
 };
 
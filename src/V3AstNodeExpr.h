@@ -4679,9 +4679,15 @@ class AstCond final : public AstNodeTriop {
     // @astgen alias op1 := condp
     // @astgen alias op2 := thenp
     // @astgen alias op3 := elsep
+    bool m_branchless = false;  // Emit as branch free select, evaluating both operands
+    bool m_guard = false;  // Condition guards validity of operands (e.g. bounds check)
 public:
     AstCond(FileLine* fl, AstNodeExpr* condp, AstNodeExpr* thenp, AstNodeExpr* elsep);
     ASTGEN_MEMBERS_AstCond;
+    bool branchless() const { return m_branchless; }
+    void branchless(bool flag) { m_branchless = flag; }
+    bool guard() const { return m_guard; }
+    void guard(bool flag) { m_guard = flag; }
     void numberOperate(V3Number& out, const V3Number& lhs, const V3Number& rhs,
                        const V3Number& ths) override {
         out.opAssign(lhs.isNeqZero() ? rhs : ths);
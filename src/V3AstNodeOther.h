@@ -96,8 +96,10 @@ class AstNodeFTask VL_NOT_FINAL : public AstNode {
     bool m_dpiExport : 1;  // DPI exported
     bool m_dpiImport : 1;  // DPI imported
     bool m_dpiContext : 1;  // DPI import context
+    bool m_dpiNative : 1;  // DPI import passes integral arguments in internal representation
     bool m_dpiOpenChild : 1;  // DPI import open array child wrapper
     bool m_dpiTask : 1;  // DPI import task (vs. void function)
+    bool m_dpiThreadSafe : 1;  // DPI import may be called concurrently from multiple threads
     bool m_isConstructor : 1;  // Class constructor
     bool m_isExternProto : 1;  // Extern prototype
     bool m_isExternDef : 1;  // Extern definition
@@ -128,8 +130,10 @@ protected:
         , m_dpiExport{false}
         , m_dpiImport{false}
         , m_dpiContext{false}
+        , m_dpiNative{false}
         , m_dpiOpenChild{false}
         , m_dpiTask{false}
+        , m_dpiThreadSafe{false}
         , m_isConstructor{false}
         , m_isExternProto{false}
         , m_isExternDef{false}
@@ -187,10 +191,14 @@ public:
     void dpiImport(bool flag) { m_dpiImport = flag; }
     bool dpiContext() const { return m_dpiContext; }
     void dpiContext(bool flag) { m_dpiContext = flag; }
+    bool dpiNative() const { return m_dpiNative; }
+    void dpiNative(bool flag) { m_dpiNative = flag; }
     bool dpiOpenChild() const { return m_dpiOpenChild; }
     void dpiOpenChild(bool flag) { m_dpiOpenChild = flag; }
     bool dpiTask() const { return m_dpiTask; }
     void dpiTask(bool flag) { m_dpiTask = flag; }
+    bool dpiThreadSafe() const { return m_dpiThreadSafe; }
+    void dpiThreadSafe(bool flag) { m_dpiThreadSafe = flag; }
     bool isConstructor() const { return m_isConstructor; }
     void isConstructor(bool flag) { m_isConstructor = flag; }
     bool isHideLocal() const { return m_isHideLocal; }
@@ -492,6 +500,8 @@ class AstCFunc final : public AstNode {
     bool m_dpiExportImpl : 1;  // DPI export implementation (called from DPI dispatcher via lookup)
     bool m_dpiImportPrototype : 1;  // This is the DPI import prototype (i.e.: provided by user)
     bool m_dpiImportWrapper : 1;  // Wrapper for invoking DPI import prototype from generated code
+    bool m_dpiNative : 1;  // DPI import prototype, integral arguments in internal representation
+    bool m_dpiThreadSafe : 1;  // DPI import wrapper, may be called concurrently
     bool m_needProcess : 1;  // Needs access to VlProcess of the caller
     bool m_recursive : 1;  // Recursive or part of recursion
     int m_cost;  // Function call cost
@@ -522,6 +532,8 @@ public:
         m_dpiExportImpl = false;
         m_dpiImportPrototype = false;
         m_dpiImportWrapper = false;
+        m_dpiNative = false;
+        m_dpiThreadSafe = false;
         m_recursive = false;
         m_cost = v3Global.opt.instrCountDpi();  // As proxy for unknown general DPI cost
     }
@@ -593,6 +605,10 @@ public:
     void dpiImportPrototype(bool flag) { m_dpiImportPrototype = flag; }
     bool dpiImportWrapper() const { return m_dpiImportWrapper; }
     void dpiImportWrapper(bool flag) { m_dpiImportWrapper = flag; }
+    bool dpiNative() const VL_MT_SAFE { return m_dpiNative; }
+    void dpiNative(bool flag) { m_dpiNative = flag; }
+    bool dpiThreadSafe() const { return m_dpiThreadSafe; }
+    void dpiThreadSafe(bool flag) { m_dpiThreadSafe = flag; }
     bool isCoroutine() const { return m_rtnType == "VlCoroutine"; }
     void recursive(bool flag) { m_recursive = flag; }
     bool recursive() const { return m_recursive; }
@@ -1866,6 +1882,7 @@ class AstVar final : public AstNode {
     // @astgen op4 := attrsp : List[AstNode] // Attributes during early parse
     // @astgen ptr := m_sensIfacep : Optional[AstIface]  // Interface type to which reads from this
     //                                                      var are sensitive
+    // @astgen ptr := m_vpiChangedp : Optional[AstVar]  // Flag set on writes, for VPI callbacks
 
     string m_name;  // Name of variable
     string m_origName;  // Original name before dot addition
@@ -1897,6 +1914,7 @@ class AstVar final : public AstNode {
     bool m_attrIsolateAssign : 1;  // User isolate_assignments attribute
     bool m_attrSFormat : 1;  // User sformat attribute
     bool m_attrSplitVar : 1;  // declared with split_var metacomment
+    bool m_attrSparse : 1;  // User sparse attribute, or selected by --sparse-threshold
     bool m_fileDescr : 1;  // File descriptor
     bool m_gotNansiType : 1;  // Linker saw Non-ANSI type declaration
     bool m_isConst : 1;  // Table contains constant data
@@ -1928,6 +1946,7 @@ class AstVar final : public AstNode {
     bool m_dfgMultidriven : 1;  // Singal is multidriven, used by DFG to avoid repeat processing
     bool m_globalConstrained : 1;  // Global constraint per IEEE 1800-2023 18.5.8
     bool m_isStdRandomizeArg : 1;  // Argument variable created for std::randomize (__Varg*)
+    bool m_alignCacheLine : 1;  // Start a new cache line in the model, to avoid false sharing
     void init() {
         m_ansi = false;
         m_declTyped = false;
@@ -1950,6 +1969,7 @@ class AstVar final : public AstNode {
         m_attrIsolateAssign = false;
         m_attrSFormat = false;
         m_attrSplitVar = false;
+        m_attrSparse = false;
         m_fileDescr = false;
         m_gotNansiType = false;
         m_isConst = false;
@@ -1981,6 +2001,7 @@ class AstVar final : public AstNode {
         m_dfgMultidriven = false;
         m_globalConstrained = false;
         m_isStdRandomizeArg = false;
+        m_alignCacheLine = false;
     }
 
 public:
@@ -2058,6 +2079,10 @@ public:
     // Return C /*public*/ type for argument: bool, uint32_t, uint64_t, etc.
     string cPubArgType(bool named, bool forReturn) const;
     string dpiArgType(bool named, bool forReturn) const;  // Return DPI-C type for argument
+    // Return true if a dpi_native import passes this argument in internal representation
+    bool isDpiNativeArg() const;
+    // Return dpi_native import type for argument: uint8_t, ..., uint64_t, uint32_t*, or DPI-C type
+    string dpiNativeArgType(bool named, bool forReturn) const;
     string dpiTmpVarType(const string& varName) const;
     // Return Verilator internal type for argument: CData, SData, IData, WData
     string vlArgType(bool named, bool forReturn, bool forFunc, const string& namespc = "",
@@ -2077,12 +2102,14 @@ public:
     void ansi(bool flag) { m_ansi = flag; }
     void declTyped(bool flag) { m_declTyped = flag; }
     void sensIfacep(AstIface* nodep) { m_sensIfacep = nodep; }
+    void vpiChangedp(AstVar* nodep) { m_vpiChangedp = nodep; }
     void attrFileDescr(bool flag) { m_fileDescr = flag; }
     void attrScBv(bool flag) { m_attrScBv = flag; }
     void attrScBigUint(bool flag) { m_attrScBigUint = flag; }
     void attrIsolateAssign(bool flag) { m_attrIsolateAssign = flag; }
     void attrSFormat(bool flag) { m_attrSFormat = flag; }
     void attrSplitVar(bool flag) { m_attrSplitVar = flag; }
+    void attrSparse(bool flag) { m_attrSparse = flag; }
     void rand(const VRandAttr flag) { m_rand = flag; }
     void usedParam(bool flag) { m_usedParam = flag; }
     void usedLoopIdx(bool flag) { m_usedLoopIdx = flag; }
@@ -2146,6 +2173,8 @@ public:
     void setIgnorePostWrite() { m_ignorePostWrite = true; }
     bool ignoreSchedWrite() const { return m_ignoreSchedWrite; }
     void setIgnoreSchedWrite() { m_ignoreSchedWrite = true; }
+    bool alignCacheLine() const { return m_alignCacheLine; }
+    void alignCacheLine(bool flag) { m_alignCacheLine = flag; }
     bool dfgMultidriven() const { return m_dfgMultidriven; }
     void setDfgMultidriven() { m_dfgMultidriven = true; }
     void globalConstrained(bool flag) { m_globalConstrained = flag; }
@@ -2236,8 +2265,10 @@ public:
     bool attrFileDescr() const { return m_fileDescr; }
     bool attrSFormat() const { return m_attrSFormat; }
     bool attrSplitVar() const { return m_attrSplitVar; }
+    bool attrSparse() const { return m_attrSparse; }
     bool attrIsolateAssign() const { return m_attrIsolateAssign; }
     AstIface* sensIfacep() const { return m_sensIfacep; }
+    AstVar* vpiChangedp() const { return m_vpiChangedp; }
     VRandAttr rand() const { return m_rand; }
     string verilogKwd() const override;
     void lifetime(const VLifetime& flag) { m_lifetime = flag; }
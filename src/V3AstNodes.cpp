@@ -850,6 +850,29 @@ string AstVar::dpiArgType(bool named, bool forReturn) const {
     }
 }
 
+bool AstVar::isDpiNativeArg() const {
+    const AstBasicDType* const bdtypep = basicp();
+    return bdtypep && (bdtypep->isDpiBitVec() || bdtypep->isDpiLogicVec()) && !isDpiOpenArray()
+           && !VN_IS(dtypep()->skipRefp(), UnpackArrayDType);
+}
+
+string AstVar::dpiNativeArgType(bool named, bool forReturn) const {
+    if (!isDpiNativeArg()) return dpiArgType(named, forReturn);
+    // Same layout as CData/SData/IData/QData/VlWide, but usable from C
+    string arg;
+    if (isWide()) {
+        arg = string{isReadOnly() ? "const " : ""} + "uint32_t*";
+    } else {
+        arg = width() <= 8    ? "uint8_t"
+              : width() <= 16 ? "uint16_t"
+              : width() <= 32 ? "uint32_t"
+                              : "uint64_t";
+        if (!forReturn && isWritable()) arg += "*";
+    }
+    if (named && !forReturn) arg += " " + name();
+    return arg;
+}
+
 string AstVar::dpiTmpVarType(const string& varName) const {
     class converter final : public dpiTypesToStringConverter {
         const string m_name;
@@ -2853,6 +2876,7 @@ void AstVar::dump(std::ostream& str) const {
     if (noReset()) str << " [!RST]";
     if (attrIsolateAssign()) str << " [aISO]";
     if (attrFileDescr()) str << " [aFD]";
+    if (attrSparse()) str << " [aSPARSE]";
     if (isFuncReturn()) {
         str << " [FUNCRTN]";
     } else if (isFuncLocal()) {
@@ -2862,6 +2886,7 @@ void AstVar::dump(std::ostream& str) const {
     if (ignorePostWrite()) str << " [IGNPWR]";
     if (ignoreSchedWrite()) str << " [IGNWR]";
     if (isStdRandomizeArg()) str << " [STDRANDARG]";
+    if (alignCacheLine()) str << " [ALIGNCL]";
     if (!lifetime().isNone()) str << " [" << lifetime().ascii() << "] ";
     str << " " << varType();
 }
@@ -3019,8 +3044,10 @@ void AstNodeFTask::dump(std::ostream& str) const {
     if (classMethod()) str << " [METHOD]";
     if (dpiExport()) str << " [DPIX]";
     if (dpiImport()) str << " [DPII]";
+    if (dpiNative()) str << " [DPINATIVE]";
     if (dpiOpenChild()) str << " [DPIOPENCHILD]";
     if (dpiOpenParent()) str << " [DPIOPENPARENT]";
+    if (dpiThreadSafe()) str << " [DPITS]";
     if (isExternDef()) str << " [EXTDEF]";
     if (isExternProto()) str << " [EXTPROTO]";
     if (isVirtual()) str << " [VIRT]";
@@ -3067,8 +3094,10 @@ void AstNodeFTask::dumpJson(std::ostream& str) const {
     dumpJsonBool(str, "method", classMethod());
     dumpJsonBoolFunc(str, dpiExport);
     dumpJsonBoolFunc(str, dpiImport);
+    dumpJsonBoolFuncIf(str, dpiNative);
     dumpJsonBoolFunc(str, dpiOpenChild);
     dumpJsonBoolFunc(str, dpiOpenParent);
+    dumpJsonBoolFuncIf(str, dpiThreadSafe);
     dumpJsonBoolFunc(str, isExternDef);
     dumpJsonBoolFunc(str, isExternProto);
     dumpJsonBoolFuncIf(str, isVirtual);
@@ -3226,7 +3255,9 @@ void AstCFunc::dump(std::ostream& str) const {
     if (dpiExportImpl()) str << " [DPIEI]";
     if (dpiImportPrototype()) str << " [DPIIP]";
     if (dpiImportWrapper()) str << " [DPIIW]";
+    if (dpiNative()) str << " [DPINATIVE]";
     if (dpiPure()) str << " [DPIPURE]";
+    if (dpiThreadSafe()) str << " [DPITS]";
     if (isConstructor()) str << " [CTOR]";
     if (isDestructor()) str << " [DTOR]";
     if (isMethod()) str << " [METHOD]";
@@ -3243,6 +3274,8 @@ void AstCFunc::dumpJson(std::ostream& str) const {
     dumpJsonBoolFunc(str, dpiExportImpl);
     dumpJsonBoolFunc(str, dpiImportPrototype);
     dumpJsonBoolFunc(str, dpiImportWrapper);
+    dumpJsonBoolFuncIf(str, dpiNative);
+    dumpJsonBoolFuncIf(str, dpiThreadSafe);
     dumpJsonBoolFunc(str, dpiContext);
     dumpJsonBoolFunc(str, isConstructor);
     dumpJsonBoolFunc(str, isDestructor);
@@ -20,6 +20,11 @@
 //      At each FTASKREF,
 //         Count calls into the function
 //      Then, if FTASK is called only once, add inline attribute
+//      With -fbranchless, at each narrow COND:
+//         If both operands are cheap and pure, and neither reads memory the
+//         condition might guard (array elements, variable bit selects, etc.),
+//         mark to emit as a branch free select, as evaluating both costs less
+//         than a mispredicted branch.
 //
 //*************************************************************************
 
@@ -27,15 +32,47 @@
 
 #include "V3Branch.h"
 
+#include "V3InstrCount.h"
+#include "V3Stats.h"
+
 VL_DEFINE_DEBUG_FUNCTIONS;
 
 //######################################################################
 // Branch state, as a visitor of each AstNode
 
 class BranchVisitor final : public VNVisitorConst {
+    // Maximum instructions in both operands of a branch free conditional
+    static constexpr uint32_t BRANCHLESS_MAX_INSTRS = 4 * AstNode::INSTR_COUNT_BRANCH;
+
     // STATE - for current visit position (use VL_RESTORER)
     int m_unlikely = 0;  // Excuses for branch likely not taken
 
+    // STATE - across all visitors
+    VDouble0 m_statBranchless;  // Statistic tracking
+
+    // METHODS
+    // Returns true if evaluating the expression may be invalid when not selected,
+    // e.g. an array element whose index is only known to be in bounds under the condition
+    static bool mayNeedGuard(AstNodeExpr* nodep) {
+        return nodep->exists([](const AstNode* np) {
+            if (const AstSel* const selp = VN_CAST(np, Sel)) return !VN_IS(selp->lsbp(), Const);
+            if (const AstCond* const condp = VN_CAST(np, Cond)) return condp->guard();
+            return VN_IS(np, NodeSel) || VN_IS(np, MemberSel) || VN_IS(np, NullCheck)
+                   || VN_IS(np, CMethodHard);
+        });
+    }
+    static bool isBranchless(AstCond* nodep) {
+        if (nodep->guard()) return false;
+        if (nodep->isWide() || nodep->isDouble() || nodep->isString()) return false;
+        if (!nodep->dtypep()->skipRefp()->isIntegralOrPacked()) return false;
+        AstNodeExpr* const thenp = nodep->thenp();
+        AstNodeExpr* const elsep = nodep->elsep();
+        if (!thenp->isPure() || !elsep->isPure()) return false;
+        if (mayNeedGuard(thenp) || mayNeedGuard(elsep)) return false;
+        return V3InstrCount::count(thenp, false) + V3InstrCount::count(elsep, false)
+               <= BRANCHLESS_MAX_INSTRS;
+    }
+
     // VISITORS
     void visit(AstNodeIf* nodep) override {
         UINFO(4, " IF: " << nodep);
@@ -56,6 +93,14 @@ class BranchVisitor final : public VNVisitorConst {
         }  // else leave unknown
     }
 
+    void visit(AstCond* nodep) override {
+        if (v3Global.opt.fBranchless() && isBranchless(nodep)) {
+            UINFO(4, " BRANCHLESS: " << nodep);
+            nodep->branchless(true);
+            ++m_statBranchless;
+        }
+        iterateChildrenConst(nodep);
+    }
     void visit(AstNode* nodep) override {
         if (nodep->isUnlikely()) {
             UINFO(4, "  UNLIKELY: " << nodep);
@@ -67,7 +112,9 @@ class BranchVisitor final : public VNVisitorConst {
 public:
     // CONSTRUCTORS
     explicit BranchVisitor(AstNetlist* nodep) { iterateChildrenConst(nodep); }
-    ~BranchVisitor() override = default;
+    ~BranchVisitor() override {
+        V3Stats::addStat("Optimizations, Branchless conditionals", m_statBranchless);
+    }
 };
 
 //######################################################################
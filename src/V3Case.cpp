@@ -24,9 +24,10 @@
 //                                                  (other items))
 //                                              body
 //              Or, converts to a if/else tree.
+//          Large tables with constants and no masking (decoders, address muxes)
+//              Sort by value and use a balanced tree of < compares, ending
+//              in == compares, so depth is logarithmic in the number of items.
 //      FUTURES:
-//          Large 16+ bit tables with constants and no masking (address muxes)
-//              Enter all into std::multimap, sort by value and use a tree of < and == compares.
 //          "Diagonal" find of {rightmost,leftmost} bit {set,clear}
 //              Ignoring mask, check each value is unique (using std::multimap as above?)
 //              Each branch is then mask-and-compare operation (IE
@@ -40,11 +41,17 @@
 
 #include "V3Stats.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 VL_DEFINE_DEBUG_FUNCTIONS;
 
 #define CASE_OVERLAP_WIDTH 16  // Maximum width we can check for overlaps in
 #define CASE_BARF 999999  // Magic width when non-constant
 #define CASE_ENCODER_GROUP_DEPTH 8  // Levels of priority to be ORed together in top IF tree
+#define CASE_SEARCH_MIN_ITEMS 8  // Minimum unique values to use a binary search tree
+#define CASE_SEARCH_LEAF_ITEMS 2  // Values compared for equality at each search tree leaf
+#define CASE_SEARCH_MAX_GROWTH 4  // Maximum growth of statement nodes from search tree cloning
 
 //######################################################################
 
@@ -135,8 +142,17 @@ class CaseVisitor final : public VNVisitor {
     //  AstIf::user3()          -> bool.  Set true to indicate clone not needed
     const VNUser3InUse m_inuser3;
 
+    // TYPES
+    struct SearchValue final {
+        uint64_t m_value;  // Case item value
+        AstConst* m_constp;  // Case item condition
+        AstCaseItem* m_itemp;  // Case item selected by this value
+        bool operator<(const SearchValue& other) const { return m_value < other.m_value; }
+    };
+
     // STATE
     VDouble0 m_statCaseFast;  // Statistic tracking
+    VDouble0 m_statCaseSearch;  // Statistic tracking
     VDouble0 m_statCaseSlow;  // Statistic tracking
     const AstNode* m_alwaysp = nullptr;  // Always in which case is located
 
@@ -148,6 +164,8 @@ class CaseVisitor final : public VNVisitor {
     // For each possible value, the case branch we need
     std::array<AstNode*, 1 << CASE_OVERLAP_WIDTH> m_valueItem;
     bool m_needToClearCache = false;  // Whether cache needs to be cleared
+    std::vector<SearchValue> m_searchValues;  // Sorted unique values, for binary search
+    AstCaseItem* m_searchDefaultp = nullptr;  // Default item, for binary search
 
     // METHODS
     //! Determine whether we should check case items are complete
@@ -438,6 +456,103 @@ class CaseVisitor final : public VNVisitor {
         UINFOTREE(9, ifrootp, "", "_simp");
     }
 
+    static int stmtsCount(AstNode* stmtsp) {
+        int count = 0;
+        for (AstNode* nodep = stmtsp; nodep; nodep = nodep->nextp()) count += nodep->nodeCount();
+        return count;
+    }
+
+    bool isCaseTreeSearch(AstCase* nodep) {
+        // Wide or incomplete case with only constant, non-wildcard items
+        m_searchValues.clear();
+        m_searchDefaultp = nullptr;
+        AstNodeExpr* const cexprp = nodep->exprp();
+        if (!cexprp->isPure() || cexprp->isDouble() || cexprp->isString()
+            || cexprp->width() > VL_QUADSIZE) {
+            return false;
+        }
+        std::unordered_set<uint64_t> values;
+        for (AstCaseItem* itemp = nodep->itemsp(); itemp;
+             itemp = VN_AS(itemp->nextp(), CaseItem)) {
+            if (itemp->isDefault()) {
+                m_searchDefaultp = itemp;
+                continue;
+            }
+            for (AstNode* icondp = itemp->condsp(); icondp; icondp = icondp->nextp()) {
+                AstConst* const iconstp = VN_CAST(icondp, Const);
+                if (!iconstp || iconstp->width() != cexprp->width()) return false;
+                if (neverItem(nodep, iconstp)) continue;
+                if (iconstp->num().isFourState()) return false;  // Wildcard
+                const uint64_t value = iconstp->num().toUQuad();
+                // Earlier items have priority over later items with the same value
+                if (!values.emplace(value).second) continue;
+                m_searchValues.push_back({value, iconstp, itemp});
+            }
+        }
+        if (m_searchValues.size() < CASE_SEARCH_MIN_ITEMS) return false;
+        // Each value's statements are cloned once, and the default into each leaf
+        std::unordered_set<const AstCaseItem*> items;
+        const int defaultCount = m_searchDefaultp ? stmtsCount(m_searchDefaultp->stmtsp()) : 0;
+        int origCount = defaultCount;
+        int treeCount = defaultCount
+                        * ((m_searchValues.size() + CASE_SEARCH_LEAF_ITEMS - 1)
+                           / CASE_SEARCH_LEAF_ITEMS);
+        for (const SearchValue& entry : m_searchValues) {
+            const int count = stmtsCount(entry.m_itemp->stmtsp());
+            if (items.emplace(entry.m_itemp).second) origCount += count;
+            treeCount += count;
+        }
+        if (treeCount > CASE_SEARCH_MAX_GROWTH * origCount + CASE_SEARCH_MIN_ITEMS) {
+            UINFO(8, "Case search tree too large: " << nodep);
+            return false;
+        }
+        std::sort(m_searchValues.begin(), m_searchValues.end());
+        return true;
+    }
+
+    AstNode* replaceCaseSearchRecurse(AstNodeExpr* cexprp, size_t lo, size_t hi) {
+        FileLine* const flp = cexprp->fileline();
+        if (hi - lo <= CASE_SEARCH_LEAF_ITEMS) {
+            // Leaf, compare the remaining values, else default
+            AstNode* resultp = nullptr;
+            if (m_searchDefaultp && m_searchDefaultp->stmtsp()) {
+                resultp = m_searchDefaultp->stmtsp()->cloneTree(true);
+            }
+            for (size_t i = hi; i-- > lo;) {
+                const SearchValue& entry = m_searchValues[i];
+                AstNode* const thensp = entry.m_itemp->stmtsp()
+                                            ? entry.m_itemp->stmtsp()->cloneTree(true)
+                                            : nullptr;
+                AstNodeExpr* const condp = AstEq::newTyped(flp, cexprp->cloneTreePure(false),
+                                                           entry.m_constp->cloneTree(false));
+                resultp = new AstIf{flp, condp, thensp, resultp};
+            }
+            return resultp;
+        }
+        // cexpr < midpoint value
+        const size_t mid = lo + (hi - lo) / 2;
+        AstNodeExpr* const condp = new AstLt{flp, cexprp->cloneTreePure(false),
+                                             m_searchValues[mid].m_constp->cloneTree(false)};
+        return new AstIf{flp, condp, replaceCaseSearchRecurse(cexprp, lo, mid),
+                         replaceCaseSearchRecurse(cexprp, mid, hi)};
+    }
+
+    void replaceCaseSearch(AstCase* nodep) {
+        // CASE(cexpr, ITEM(v0, s0), ITEM(v1, s1), ..., ITEM(default, sd))
+        // ->  IF(cexpr < vmid, IF(cexpr == v0, s0, IF(cexpr == v1, s1, sd)),
+        //                      IF(...))
+        AstNodeExpr* const cexprp = nodep->exprp()->unlinkFrBack();
+        UINFOTREE(9, nodep, "", "_search_IN");
+        // Handle any assertions
+        replaceCaseParallel(nodep, false);
+        AstNode* const ifrootp = replaceCaseSearchRecurse(cexprp, 0, m_searchValues.size());
+        nodep->replaceWith(ifrootp);
+        VL_DO_DANGLING(nodep->deleteTree(), nodep);
+        VL_DO_DANGLING(cexprp->deleteTree(), cexprp);
+        m_searchValues.clear();
+        UINFOTREE(9, ifrootp, "", "_search");
+    }
+
     void replaceCaseComplicated(AstCase* nodep) {
         // CASEx(cexpr,ITEM(icond1,istmts1),ITEM(icond2,istmts2),ITEM(default,istmts3))
         // ->  IF((cexpr==icond1),istmts1,
@@ -628,8 +743,14 @@ class CaseVisitor final : public VNVisitor {
             // If a case statement is whole, presume signals involved aren't forming a latch
             if (m_alwaysp && !m_caseIncomplete)
                 m_alwaysp->fileline()->warnOff(V3ErrorCode::LATCH, true);
-            ++m_statCaseSlow;
-            VL_DO_DANGLING(replaceCaseComplicated(nodep), nodep);
+            if (v3Global.opt.fCase() && isCaseTreeSearch(nodep)) {
+                // Many constant items, make a binary search tree of compares
+                ++m_statCaseSearch;
+                VL_DO_DANGLING(replaceCaseSearch(nodep), nodep);
+            } else {
+                ++m_statCaseSlow;
+                VL_DO_DANGLING(replaceCaseComplicated(nodep), nodep);
+            }
         }
     }
     //--------------------
@@ -649,6 +770,7 @@ public:
     }
     ~CaseVisitor() override {
         V3Stats::addStat("Optimizations, Cases parallelized", m_statCaseFast);
+        V3Stats::addStat("Optimizations, Cases binary searched", m_statCaseSearch);
         V3Stats::addStat("Optimizations, Cases complex", m_statCaseSlow);
     }
 };
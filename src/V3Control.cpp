@@ -182,6 +182,8 @@ class V3ControlFTask final {
     V3ControlVarResolver m_params;  // Parameters in function/task
     V3ControlVarResolver m_ports;  // Ports in function/task
     V3ControlVarResolver m_vars;  // Variables in function/task
+    bool m_dpiNative = false;  // DPI import passes internal representation
+    bool m_dpiThreadSafe = false;  // DPI import may be called concurrently
     bool m_isolate = false;  // Isolate function return
     bool m_noinline = false;  // Don't inline function/task
     bool m_public = false;  // Public function/task
@@ -190,6 +192,8 @@ public:
     V3ControlFTask() = default;
     void update(const V3ControlFTask& f) {
         // Don't overwrite true with false
+        if (f.m_dpiNative) m_dpiNative = true;
+        if (f.m_dpiThreadSafe) m_dpiThreadSafe = true;
         if (f.m_isolate) m_isolate = true;
         if (f.m_noinline) m_noinline = true;
         if (f.m_public) m_public = true;
@@ -203,6 +207,8 @@ public:
     V3ControlVarResolver& ports() { return m_ports; }
     V3ControlVarResolver& vars() { return m_vars; }
 
+    void setDpiNative(bool set) { m_dpiNative = set; }
+    void setDpiThreadSafe(bool set) { m_dpiThreadSafe = set; }
     void setIsolate(bool set) { m_isolate = set; }
     void setNoInline(bool set) { m_noinline = set; }
     void setPublic(bool set) { m_public = set; }
@@ -212,6 +218,9 @@ public:
             ftaskp->addStmtsp(new AstPragma{ftaskp->fileline(), VPragmaType::NO_INLINE_TASK});
         if (m_public)
             ftaskp->addStmtsp(new AstPragma{ftaskp->fileline(), VPragmaType::PUBLIC_TASK});
+        // Ignored unless a DPI import
+        if (m_dpiNative) ftaskp->dpiNative(true);
+        if (m_dpiThreadSafe) ftaskp->dpiThreadSafe(true);
         // Only functions can have isolate (return value)
         if (VN_IS(ftaskp, Func)) ftaskp->attrIsolateAssign(m_isolate);
     }
@@ -881,6 +890,22 @@ void V3Control::addHierWorkers(FileLine* fl, const string& model, int workers) {
     V3ControlResolver::s().addHierWorkers(fl, model, workers);
 }
 
+void V3Control::addDpiNative(FileLine* fl, const string& module, const string& ftask) {
+    if (ftask.empty()) {
+        fl->v3error("dpi_native requires -function or -task");
+    } else {
+        V3ControlResolver::s().modules().at(module).ftasks().at(ftask).setDpiNative(true);
+    }
+}
+
+void V3Control::addDpiThreadSafe(FileLine* fl, const string& module, const string& ftask) {
+    if (ftask.empty()) {
+        fl->v3error("dpi_thread_safe requires -function or -task");
+    } else {
+        V3ControlResolver::s().modules().at(module).ftasks().at(ftask).setDpiThreadSafe(true);
+    }
+}
+
 void V3Control::addIgnore(V3ErrorCode code, bool on, const string& filename, int min, int max) {
     UINFO(9, "addIgnore " << code << " " << min << "-" << max << " fn=" << filename);
     if (filename == "*") {  // For "lint_off/lint_on [--rule x]"
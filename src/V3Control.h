@@ -40,6 +40,8 @@ public:
     static void addCoverageBlockOff(const string& file, int lineno);
     static void addCoverageBlockOff(const string& module, const string& blockname);
     static void addHierWorkers(FileLine* fl, const string& model, int workers);
+    static void addDpiNative(FileLine* fl, const string& module, const string& ftask);
+    static void addDpiThreadSafe(FileLine* fl, const string& module, const string& ftask);
     static void addIgnore(V3ErrorCode code, bool on, const string& filename, int min, int max);
     static void addIgnoreMatch(V3ErrorCode code, const string& filename, const string& contents,
                                const string& match);
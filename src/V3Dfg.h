@@ -191,9 +191,9 @@ public:
 
 protected:
     // CONSTRUCTOR
-    DfgVertex(DfgGraph& dfg, VDfgType type, FileLine* flp, const DfgDataType& dt) VL_MT_DISABLED;
+    DfgVertex(DfgGraph& dfg, VDfgType type, FileLine* flp, const DfgDataType& dt) VL_MT_STABLE;
     // Use unlinkDelete instead
-    virtual ~DfgVertex() VL_MT_DISABLED = default;
+    virtual ~DfgVertex() VL_MT_STABLE = default;
 
     // Create a new input edge and return it
     DfgEdge* newInput() {
@@ -261,7 +261,7 @@ public:
     DfgVertex* firtsSinkp() { return m_sinks.empty() ? nullptr : m_sinks.frontp()->dstp(); }
 
     // Unlink from container (graph or builder), then delete this vertex
-    void unlinkDelete(DfgGraph& dfg) VL_MT_DISABLED;
+    void unlinkDelete(DfgGraph& dfg) VL_MT_STABLE;
 
     // Relink all sinks to be driven from the given new source
     void replaceWith(DfgVertex* vtxp) {
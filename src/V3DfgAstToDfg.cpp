@@ -288,12 +288,14 @@ public:
 };
 
 std::unique_ptr<DfgGraph> V3DfgPasses::astToDfg(AstModule& module, V3DfgContext& ctx) {
+    const V3StatsTimer statsTimer{"DfgPasses::astToDfg"};
     DfgGraph* const dfgp = new DfgGraph{&module, module.name()};
     AstToDfgVisitor</* T_Scoped: */ false>::apply(*dfgp, module, ctx.m_ast2DfgContext);
     return std::unique_ptr<DfgGraph>{dfgp};
 }
 
 std::unique_ptr<DfgGraph> V3DfgPasses::astToDfg(AstNetlist& netlist, V3DfgContext& ctx) {
+    const V3StatsTimer statsTimer{"DfgPasses::astToDfg"};
     DfgGraph* const dfgp = new DfgGraph{nullptr, "netlist"};
     AstToDfgVisitor</* T_Scoped: */ true>::apply(*dfgp, netlist, ctx.m_ast2DfgContext);
     return std::unique_ptr<DfgGraph>{dfgp};
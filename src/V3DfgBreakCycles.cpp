@@ -1261,6 +1261,7 @@ breakCycles(const DfgGraph& dfg, V3DfgContext& ctx) {
 
 std::pair<std::unique_ptr<DfgGraph>, bool>  //
 V3DfgPasses::breakCycles(const DfgGraph& dfg, V3DfgContext& ctx) {
+    const V3StatsTimer statsTimer{"DfgPasses::breakCycles"};
     auto pair = V3DfgBreakCycles::breakCycles(dfg, ctx);
     if (pair.first) {
         if (v3Global.opt.debugCheck()) V3DfgPasses::typeCheck(*pair.first);
@@ -49,9 +49,7 @@ protected:
         , m_label{label}
         , m_name{name} {}
 
-    void addStat(const std::string& what, double value) {
-        V3Stats::addStat("Optimizations, DFG " + m_label + " " + m_name + ", " + what, value);
-    }
+    inline void addStat(const std::string& what, double value);
 
 public:
     inline const std::string& prefix() const;
@@ -333,6 +331,8 @@ private:
 class V3DfgContext final {
     const std::string m_label;  // Label to add to stats, etc.
     const std::string m_prefix;  // Prefix to add to file dumps (derived from label)
+    // Context to merge statistics into on destruction, for worker contexts only
+    V3DfgContext* const m_parentp = nullptr;
 
 public:
     // STATE
@@ -358,8 +358,23 @@ public:
     explicit V3DfgContext(const std::string& label)
         : m_label{label}
         , m_prefix{VString::removeWhitespace(label) + "-"} {}
+    // Worker context, for running the concurrent stages of V3DfgPasses::optimize
+    explicit V3DfgContext(V3DfgContext& parent)
+        : m_label{parent.m_label}
+        , m_prefix{parent.m_prefix}
+        , m_parentp{&parent} {}
 
     ~V3DfgContext() {
+        if (m_parentp) {
+            // Only the passes run by the concurrent stages count into worker contexts
+            m_parentp->m_cseContext0.m_eliminated += m_cseContext0.m_eliminated;
+            m_parentp->m_cseContext1.m_eliminated += m_cseContext1.m_eliminated;
+            for (size_t i = 0; i < m_peepholeContext.m_count.size(); ++i) {
+                m_parentp->m_peepholeContext.m_count[i] += m_peepholeContext.m_count[i];
+            }
+            return;
+        }
+
         const string front = "Optimizations, DFG " + label() + " General, ";
         V3Stats::addStat(front + "modules", m_modules);
 
@@ -385,8 +400,14 @@ public:
     // ACCESSORS
     const std::string& label() const { return m_label; }
     const std::string& prefix() const { return m_prefix; }
+    bool isWorker() const { return m_parentp != nullptr; }
 };
 
 const std::string& V3DfgSubContext::prefix() const { return m_ctx.prefix(); }
 
+void V3DfgSubContext::addStat(const std::string& what, double value) {
+    if (m_ctx.isWorker()) return;  // Reported via the parent context
+    V3Stats::addStat("Optimizations, DFG " + m_label + " " + m_name + ", " + what, value);
+}
+
 #endif  //VERILATOR_V3DFGCONTEXT_H_
@@ -26,6 +26,7 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 
 const DfgDataType* DfgDataType::s_nullTypep{nullptr};
 std::unordered_map<uint32_t, const DfgDataType*> DfgDataType::s_packedTypes{};
+V3Mutex DfgDataType::s_mutex;
 
 //------------------------------------------------------------------------------
 // Type checker - for internal validation only
@@ -50,6 +50,7 @@
 #include "V3Ast.h"
 #include "V3Error.h"
 #include "V3Global.h"
+#include "V3Mutex.h"
 
 #include <memory>
 #include <unordered_map>
@@ -65,7 +66,9 @@ class DfgDataType final {
     // STATE
     const Kind m_kind;  // The type category
     uint32_t m_size;  // The number of elements in this type
-    AstNodeDType* const m_astDtypep;  // Equivalent canonical AstNodeDType
+    // Equivalent canonical AstNodeDType, created on first use. Types might be interned by
+    // DfgGraphs optimized concurrently, but the Ast must only be modified on the main thread.
+    mutable AstNodeDType* m_astDtypep = nullptr;
     const DfgDataType* const m_elemDtypep;  // Type of elements - for arrays only
     // Static singleton Null type
     static const DfgDataType* s_nullTypep;
@@ -74,12 +77,15 @@ class DfgDataType final {
     // Map from 'elements' -> 'interned Array DfgDataType with that many elements of *this* type'
     mutable std::unordered_map<uint32_t, const DfgDataType*> m_arrayTypes;
 
+    // Guards the interned types, as DfgGraphs might be optimized concurrently
+    static V3Mutex s_mutex;
+
     // METHODS
     static AstNodeDType* canonicalPackedDType(uint32_t width) {
         return v3Global.rootp()->typeTablep()->findLogicDType(width, width, VSigning::UNSIGNED);
     }
     static AstNodeDType* canonicalArrayDType(uint32_t size, const DfgDataType& elemType) {
-        AstNodeDType* const elemDTypep = elemType.m_astDtypep;
+        AstNodeDType* const elemDTypep = elemType.astDtypep();
         FileLine* const flp = elemDTypep->fileline();
         AstRange* const rangep = new AstRange{flp, static_cast<int>(size - 1), 0};
         AstNodeDType* const dtypep = new AstUnpackArrayDType{flp, elemDTypep, rangep};
@@ -91,17 +97,14 @@ class DfgDataType final {
     DfgDataType()
         : m_kind{Kind::Null}
         , m_size{0}
-        , m_astDtypep{v3Global.rootp()->findVoidDType()}
         , m_elemDtypep{nullptr} {}
     explicit DfgDataType(uint32_t size)
         : m_kind{Kind::Packed}
         , m_size{size}
-        , m_astDtypep{canonicalPackedDType(size)}
         , m_elemDtypep{nullptr} {}
     DfgDataType(uint32_t size, const DfgDataType& elemType)
         : m_kind{Kind::Array}
         , m_size{size}
-        , m_astDtypep{canonicalArrayDType(size, elemType)}
         , m_elemDtypep{&elemType} {}
 
     VL_UNCOPYABLE(DfgDataType);
@@ -119,7 +122,16 @@ public:
     bool isArray() const { return m_kind == Kind::Array; }
     // Size of type (this is 'width' for Ppacked, 'elements' for Array, 0 for Null)
     uint32_t size() const { return m_size; }
-    AstNodeDType* astDtypep() const { return m_astDtypep; }
+    AstNodeDType* astDtypep() const VL_MT_DISABLED {
+        if (!m_astDtypep) {
+            switch (m_kind) {
+            case Kind::Packed: m_astDtypep = canonicalPackedDType(m_size); break;
+            case Kind::Array: m_astDtypep = canonicalArrayDType(m_size, *m_elemDtypep); break;
+            case Kind::Null: m_astDtypep = v3Global.rootp()->findVoidDType(); break;
+            }
+        }
+        return m_astDtypep;
+    }
 
     // Thanks to the interning, equality is identity
     bool operator==(const DfgDataType& that) const { return this == &that; }
@@ -137,6 +149,7 @@ public:
     // Returns a Packed type of the given width
     static const DfgDataType& packed(uint32_t width) {
         // Find or create the right sized packed type
+        const V3LockGuard lock{s_mutex};
         const DfgDataType*& entryr = s_packedTypes[width];
         if (!entryr) entryr = new DfgDataType{width};
         return *entryr;
@@ -146,6 +159,7 @@ public:
     static const DfgDataType& array(const DfgDataType& elemType, uint32_t size) {
         UASSERT(elemType.isPacked(), "Cannot create multi-dimensional arrays yet");
         // Find or create the right sized array type with this as elements
+        const V3LockGuard lock{s_mutex};
         const DfgDataType*& entryr = elemType.m_arrayTypes[size];
         if (!entryr) entryr = new DfgDataType{size, elemType};
         return *entryr;
@@ -153,6 +167,7 @@ public:
 
     // Returns the singleton Null type
     static const DfgDataType& null() {
+        const V3LockGuard lock{s_mutex};
         if (!s_nullTypep) s_nullTypep = new DfgDataType{};
         return *s_nullTypep;
     }
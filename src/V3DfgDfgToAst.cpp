@@ -308,6 +308,7 @@ public:
 };
 
 void V3DfgPasses::dfgToAst(DfgGraph& dfg, V3DfgContext& ctx) {
+    const V3StatsTimer statsTimer{"DfgPasses::dfgToAst"};
     if (dfg.modulep()) {
         DfgToAstVisitor</* T_Scoped: */ false>::apply(dfg, ctx.m_dfg2AstContext);
     } else {
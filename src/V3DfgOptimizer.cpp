@@ -18,7 +18,7 @@
 //
 //*************************************************************************
 
-#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+#include "V3PchAstMT.h"
 
 #include "V3DfgOptimizer.h"
 
@@ -26,6 +26,7 @@
 #include "V3Dfg.h"
 #include "V3DfgPasses.h"
 #include "V3Graph.h"
+#include "V3ThreadPool.h"
 #include "V3UniqueNames.h"
 
 #include <vector>
@@ -310,6 +311,58 @@ class DataflowOptimize final {
         });
     }
 
+    // Optimize independent graphs. If multiple threads are available, the stages of the
+    // optimization that do not modify the Ast are applied to the graphs concurrently.
+    void optimizeComponents(const std::vector<std::unique_ptr<DfgGraph>>& components) {
+        // There is absolutely nothing useful we can do with a graph of size 2 or less
+        std::vector<DfgGraph*> graphps;
+        for (const std::unique_ptr<DfgGraph>& component : components) {
+            if (component->size() > 2) graphps.push_back(component.get());
+        }
+        const size_t nWorkers
+            = std::min<size_t>(std::max(v3Global.opt.verilateJobs(), 1), graphps.size());
+        // Debug dumps must be written from the main thread
+        if (nWorkers <= 1 || dumpDfgLevel() >= 3) {
+            for (DfgGraph* const graphp : graphps) V3DfgPasses::optimize(*graphp, m_ctx);
+            return;
+        }
+
+        // Distribute the graphs, largest first, always to the least loaded worker
+        std::vector<DfgGraph*> sortedps = graphps;
+        std::stable_sort(sortedps.begin(), sortedps.end(),
+                         [](const DfgGraph* ap, const DfgGraph* bp) {  //
+                             return ap->size() > bp->size();
+                         });
+        std::vector<std::vector<DfgGraph*>> workerGraphps(nWorkers);
+        std::vector<size_t> workerLoads(nWorkers, 0);
+        for (DfgGraph* const graphp : sortedps) {
+            const size_t i = std::distance(
+                workerLoads.begin(), std::min_element(workerLoads.begin(), workerLoads.end()));
+            workerGraphps[i].push_back(graphp);
+            workerLoads[i] += graphp->size();
+        }
+
+        // Each worker counts statistics into its own context, merged when it is destroyed
+        std::vector<std::unique_ptr<V3DfgContext>> workerCtxps;
+        for (size_t i = 0; i < nWorkers; ++i) workerCtxps.emplace_back(new V3DfgContext{m_ctx});
+        const auto runConcurrently = [&](void (*stagep)(DfgGraph&, V3DfgContext&)) {
+            V3ThreadScope threadScope;
+            for (size_t i = 0; i < nWorkers; ++i) {
+                V3DfgContext& ctx = *workerCtxps[i];
+                const std::vector<DfgGraph*>& workps = workerGraphps[i];
+                threadScope.enqueue([&ctx, &workps, stagep]() {
+                    for (DfgGraph* const graphp : workps) stagep(*graphp, ctx);
+                });
+            }
+        };
+
+        runConcurrently(V3DfgPasses::optimizeEarly);
+        // Stages modifying the Ast run on the main thread, in order, to be deterministic
+        for (DfgGraph* const graphp : graphps) V3DfgPasses::optimizeAst(*graphp, m_ctx);
+        runConcurrently(V3DfgPasses::optimizeLate);
+        for (DfgGraph* const graphp : graphps) V3DfgPasses::optimizeDone(*graphp, m_ctx);
+    }
+
     void optimize(DfgGraph& dfg) {
         // Dump the initial graph for debugging
         if (dumpDfgLevel() >= 8) dfg.dumpDotFilePrefixed(m_ctx.prefix() + "dfg-in");
@@ -354,9 +407,7 @@ class DataflowOptimize final {
         UASSERT(dfg.size() == 0, "DfgGraph should have become empty");
 
         // Optimize each acyclic component
-        for (const std::unique_ptr<DfgGraph>& component : acyclicComponents) {
-            V3DfgPasses::optimize(*component, m_ctx);
-        }
+        optimizeComponents(acyclicComponents);
 
         // Merge everything back under the main DFG
         dfg.mergeGraphs(std::move(acyclicComponents));
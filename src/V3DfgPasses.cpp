@@ -349,31 +349,51 @@ void V3DfgPasses::binToOneHot(DfgGraph& dfg, V3DfgBinToOneHotContext& ctx) {
     }
 }
 
-void V3DfgPasses::optimize(DfgGraph& dfg, V3DfgContext& ctx) {
-    // There is absolutely nothing useful we can do with a graph of size 2 or less
-    if (dfg.size() <= 2) return;
-
-    const auto run = [&](const std::string& name, bool dump, std::function<void()> pass) {
-        // Apply the pass
+// Apply one pass of 'optimize', with debug dump and type check
+static void runPass(DfgGraph& dfg, V3DfgContext& ctx, const std::string& name, bool dump,
+                    const std::function<void()>& pass) VL_MT_STABLE {
+    // Apply the pass
+    {
+        const V3StatsTimer statsTimer{"DfgPasses::" + VString::removeWhitespace(name)};
         pass();
-        // Debug dump
-        if (dump) dfg.dumpDotFilePrefixed(ctx.prefix() + "opt-" + VString::removeWhitespace(name));
-        // Internal type check
-        if (v3Global.opt.debugCheck()) V3DfgPasses::typeCheck(dfg);
-    };
+    }
+    // Debug dump
+    if (dump) dfg.dumpDotFilePrefixed(ctx.prefix() + "opt-" + VString::removeWhitespace(name));
+    // Internal type check
+    if (v3Global.opt.debugCheck()) V3DfgPasses::typeCheck(dfg);
+}
+
+void V3DfgPasses::optimizeEarly(DfgGraph& dfg, V3DfgContext& ctx) {
+    const uint32_t dumpLvl = dumpDfgLevel();
+    runPass(dfg, ctx, "input       ", dumpLvl >= 3, [&]() { /* debug dump only */ });
+    runPass(dfg, ctx, "inlineVars  ", dumpLvl >= 4, [&]() { inlineVars(dfg); });
+    runPass(dfg, ctx, "cse0        ", dumpLvl >= 4, [&]() { cse(dfg, ctx.m_cseContext0); });
+}
 
-    // Currend debug dump level
+void V3DfgPasses::optimizeAst(DfgGraph& dfg, V3DfgContext& ctx) {
     const uint32_t dumpLvl = dumpDfgLevel();
+    runPass(dfg, ctx, "binToOneHot ", dumpLvl >= 4,
+            [&]() { binToOneHot(dfg, ctx.m_binToOneHotContext); });
+}
 
-    // Run passes
-    run("input       ", dumpLvl >= 3, [&]() { /* debug dump only */ });
-    run("inlineVars  ", dumpLvl >= 4, [&]() { inlineVars(dfg); });
-    run("cse0        ", dumpLvl >= 4, [&]() { cse(dfg, ctx.m_cseContext0); });
-    run("binToOneHot ", dumpLvl >= 4, [&]() { binToOneHot(dfg, ctx.m_binToOneHotContext); });
-    run("peephole    ", dumpLvl >= 4, [&]() { peephole(dfg, ctx.m_peepholeContext); });
-    run("cse1        ", dumpLvl >= 4, [&]() { cse(dfg, ctx.m_cseContext1); });
-    run("output      ", dumpLvl >= 3, [&]() { /* debug dump only */ });
+void V3DfgPasses::optimizeLate(DfgGraph& dfg, V3DfgContext& ctx) {
+    const uint32_t dumpLvl = dumpDfgLevel();
+    runPass(dfg, ctx, "peephole    ", dumpLvl >= 4,
+            [&]() { peephole(dfg, ctx.m_peepholeContext); });
+    runPass(dfg, ctx, "cse1        ", dumpLvl >= 4, [&]() { cse(dfg, ctx.m_cseContext1); });
+}
 
+void V3DfgPasses::optimizeDone(DfgGraph& dfg, V3DfgContext& ctx) {
+    runPass(dfg, ctx, "output      ", dumpDfgLevel() >= 3, [&]() { /* debug dump only */ });
     // Accumulate patterns for reporting
     if (v3Global.opt.stats()) ctx.m_patternStats.accumulate(dfg);
 }
+
+void V3DfgPasses::optimize(DfgGraph& dfg, V3DfgContext& ctx) {
+    // There is absolutely nothing useful we can do with a graph of size 2 or less
+    if (dfg.size() <= 2) return;
+    optimizeEarly(dfg, ctx);
+    optimizeAst(dfg, ctx);
+    optimizeLate(dfg, ctx);
+    optimizeDone(dfg, ctx);
+}
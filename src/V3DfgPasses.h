@@ -55,6 +55,15 @@ breakCycles(const DfgGraph&, V3DfgContext&) VL_MT_DISABLED;
 // Optimize the given DfgGraph
 void optimize(DfgGraph&, V3DfgContext&) VL_MT_DISABLED;
 
+// The stages of 'optimize'. Calling these in order on a graph with more than 2 vertices is
+// equivalent to 'optimize'. The VL_MT_STABLE stages only modify the given graph, and not the
+// Ast, so can be applied concurrently to independent graphs, each with its own context,
+// provided DFG debug dumps are disabled. The other stages must run on the main thread.
+void optimizeEarly(DfgGraph&, V3DfgContext&) VL_MT_STABLE;
+void optimizeAst(DfgGraph&, V3DfgContext&) VL_MT_DISABLED;
+void optimizeLate(DfgGraph&, V3DfgContext&) VL_MT_STABLE;
+void optimizeDone(DfgGraph&, V3DfgContext&) VL_MT_DISABLED;
+
 // Convert DfgGraph back into Ast, and insert converted graph back into the Ast.
 void dfgToAst(DfgGraph&, V3DfgContext&) VL_MT_DISABLED;
 
@@ -73,17 +82,17 @@ void binToOneHot(DfgGraph&, V3DfgBinToOneHotContext&) VL_MT_DISABLED;
 // Returns the number of non-trivial SCCs (distinct cycles)
 uint32_t colorStronglyConnectedComponents(const DfgGraph&, DfgUserMap<uint64_t>&) VL_MT_DISABLED;
 // Common subexpression elimination
-void cse(DfgGraph&, V3DfgCseContext&) VL_MT_DISABLED;
+void cse(DfgGraph&, V3DfgCseContext&) VL_MT_STABLE;
 // Inline fully driven variables
-void inlineVars(DfgGraph&) VL_MT_DISABLED;
+void inlineVars(DfgGraph&) VL_MT_STABLE;
 // Peephole optimizations
-void peephole(DfgGraph&, V3DfgPeepholeContext&) VL_MT_DISABLED;
+void peephole(DfgGraph&, V3DfgPeepholeContext&) VL_MT_STABLE;
 // Regularize graph. This must be run before converting back to Ast.
 void regularize(DfgGraph&, V3DfgRegularizeContext&) VL_MT_DISABLED;
 // Remove unused nodes
 void removeUnused(DfgGraph&) VL_MT_DISABLED;
 // Check all types are consistent. This will not return if there is a type error.
-void typeCheck(const DfgGraph&) VL_MT_DISABLED;
+void typeCheck(const DfgGraph&) VL_MT_STABLE;
 
 }  // namespace V3DfgPasses
 
@@ -309,5 +309,6 @@ public:
 };
 
 void V3DfgPasses::regularize(DfgGraph& dfg, V3DfgRegularizeContext& ctx) {
+    const V3StatsTimer statsTimer{"DfgPasses::regularize"};
     DfgRegularize::apply(dfg, ctx);
 }
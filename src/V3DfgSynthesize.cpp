@@ -1956,6 +1956,7 @@ static void dfgSelectLogicForSynthesis(DfgGraph& dfg) {
 }
 
 void V3DfgPasses::synthesize(DfgGraph& dfg, V3DfgContext& ctx) {
+    const V3StatsTimer statsTimer{"DfgPasses::synthesize"};
     // Select which DfgLogic to attempt to synthesize
     dfgSelectLogicForSynthesis(dfg);
     // Synthesize them - also removes un-synthesized DfgLogic, so must run even if nothing selected
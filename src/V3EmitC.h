@@ -24,10 +24,10 @@
 
 class V3EmitC final {
 public:
-    static void emitcConstPool() VL_MT_DISABLED;
+    static void emitcConstPool(bool release) VL_MT_DISABLED;
     static void emitcFiles() VL_MT_DISABLED;
     static void emitcHeaders() VL_MT_DISABLED;
-    static void emitcImp();
+    static void emitcImp(bool release);
     static void emitcInlines() VL_MT_DISABLED;
     static void emitcModel() VL_MT_DISABLED;
     static void emitcPch() VL_MT_DISABLED;
@@ -74,6 +74,39 @@ string EmitCUtil::prefixNameProtect(const AstNode* nodep) VL_MT_STABLE {
 //######################################################################
 // EmitCBaseVisitor implementation
 
+// Count nodes under 'nodep' (including itself, but not its siblings), and the deepest nesting
+// of expressions among them
+static void compileCostCount(const AstNode* nodep, uint32_t depth, size_t& nodes,
+                             uint32_t& maxDepth) {
+    ++nodes;
+    if (VN_IS(nodep, NodeExpr)) maxDepth = std::max(maxDepth, ++depth);
+    for (const AstNode* const opp : {nodep->op1p(), nodep->op2p(), nodep->op3p(), nodep->op4p()}) {
+        for (const AstNode* itemp = opp; itemp; itemp = itemp->nextp()) {
+            compileCostCount(itemp, depth, nodes, maxDepth);
+        }
+    }
+}
+
+size_t EmitCBaseVisitorConst::compileCost(const AstCFunc* funcp) {
+    // Functions up to this size, and expressions up to this depth, cost their node count
+    constexpr size_t LARGE_FUNC_NODES = 4096;
+    constexpr uint32_t DEEP_EXPR_DEPTH = 32;
+
+    size_t nodes = 0;
+    uint32_t maxDepth = 0;
+    compileCostCount(funcp, 0, nodes, maxDepth);
+    size_t cost = nodes;
+    // Optimizing compilers scale worse than linearly with function size (e.g. register
+    // allocation, instruction scheduling), so charge quadratically for the excess
+    if (nodes > LARGE_FUNC_NODES) {
+        const size_t excess = nodes - LARGE_FUNC_NODES;
+        cost += excess * excess / (4 * LARGE_FUNC_NODES);
+    }
+    // Deep expressions result in many live temporaries, similarly costly to allocate
+    if (maxDepth > DEEP_EXPR_DEPTH) cost += nodes * (maxDepth - DEEP_EXPR_DEPTH) / DEEP_EXPR_DEPTH;
+    return cost;
+}
+
 string EmitCBaseVisitorConst::funcNameProtect(const AstCFunc* nodep, const AstNodeModule* modp) {
     modp = modp ? modp : EmitCParentModule::get(nodep);
     string name;
@@ -113,7 +146,9 @@ string EmitCBaseVisitorConst::cFuncArgs(const AstCFunc* nodep) {
         if (const AstVar* const portp = VN_CAST(stmtp, Var)) {
             if (portp->isIO() && !portp->isFuncReturn()) {
                 if (!args.empty()) args += ", ";
-                if (nodep->dpiImportPrototype() || nodep->dpiExportDispatcher()) {
+                if (nodep->dpiNative()) {
+                    args += portp->dpiNativeArgType(true, false);
+                } else if (nodep->dpiImportPrototype() || nodep->dpiExportDispatcher()) {
                     args += portp->dpiArgType(true, false);
                 } else if (nodep->funcPublic()) {
                     args += portp->cPubArgType(true, false);
@@ -176,6 +211,8 @@ void EmitCBaseVisitorConst::emitVarDecl(const AstVar* nodep, bool asRef) {
         }
     };
 
+    if (!asRef && nodep->alignCacheLine()) puts("alignas(VL_CACHE_LINE_BYTES) ");
+
     if (nodep->isPrimaryIO() && nodep->isSc()) {
         UASSERT_OBJ(basicp, nodep, "Unimplemented: Outputting this data type");
         if (nodep->isInout()) {
@@ -231,6 +268,13 @@ void EmitCBaseVisitorConst::emitVarDecl(const AstVar* nodep, bool asRef) {
         puts("," + cvtToStr(basicp->lo() + nodep->width() - 1) + "," + cvtToStr(basicp->lo()));
         if (nodep->isWide()) puts("," + cvtToStr(nodep->widthWords()));
         puts(");\n");
+    } else if (nodep->attrSparse()) {
+        const AstUnpackArrayDType* const adtypep = VN_AS(nodep->dtypeSkipRefp(), UnpackArrayDType);
+        putns(nodep, "VlSparseUnpacked<" + adtypep->subDTypep()->cType("", false, false) + ", "
+                         + cvtToStr(adtypep->elementsConst()) + ">");
+        puts(asRef ? "& " : " ");
+        putns(nodep, nodep->nameProtect());
+        puts(";\n");
     } else {
         // Strings and other fundamental C types
         if (nodep->isFuncLocal() && nodep->isString()) {
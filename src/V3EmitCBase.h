@@ -163,6 +163,8 @@ public:
     void splitSizeInc(const AstNode* nodep) {
         splitSizeInc(static_cast<size_t>(nodep->nodeCount()));
     }
+    // Estimated effort for the C++ compiler to compile the given function, in units of nodes
+    static size_t compileCost(const AstCFunc* funcp) VL_MT_STABLE;
     bool splitNeeded(size_t splitLimit) const { return m_splitSize >= splitLimit; }
     bool splitNeeded() const { return splitNeeded(m_splitLimit); }
 
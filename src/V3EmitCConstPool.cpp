@@ -35,6 +35,7 @@ class EmitCConstPool final : public EmitCConstInit {
     using OutCFilePair = std::pair<V3OutCFile*, AstCFile*>;
 
     // MEMBERS
+    const bool m_release;  // Delete initializers once written
     VDouble0 m_tablesEmitted;
     VDouble0 m_constsEmitted;
     V3UniqueNames m_uniqueNames;  // Generates unique file names
@@ -44,9 +45,9 @@ class EmitCConstPool final : public EmitCConstInit {
     void emitVars(const AstConstPool* poolp) {
         UASSERT(!ofp(), "Output file should not be open");
 
-        std::vector<const AstVar*> varps;
+        std::vector<AstVar*> varps;
         for (AstNode* nodep = poolp->modp()->stmtsp(); nodep; nodep = nodep->nextp()) {
-            if (const AstVar* const varp = VN_CAST(nodep, Var)) varps.push_back(varp);
+            if (AstVar* const varp = VN_CAST(nodep, Var)) varps.push_back(varp);
         }
 
         if (varps.empty()) return;  // Constant pool is empty, so we are done
@@ -55,7 +56,7 @@ class EmitCConstPool final : public EmitCConstInit {
             return ap->name() < bp->name();
         });
 
-        for (const AstVar* varp : varps) {
+        for (AstVar* const varp : varps) {
             if (splitNeeded()) {
                 // Splitting file, so using parallel build.
                 v3Global.useParallelBuild(true);
@@ -85,6 +86,9 @@ class EmitCConstPool final : public EmitCConstInit {
             } else {
                 ++m_constsEmitted;
             }
+            // Later code only references the variable, so the (possibly huge) initializer
+            // can go as soon as it is written
+            if (m_release) varp->valuep()->unlinkFrBack()->deleteTree();
         }
 
         if (ofp()) closeOutputFile();
@@ -103,7 +107,8 @@ class EmitCConstPool final : public EmitCConstInit {
     }
 
 public:
-    explicit EmitCConstPool(const AstConstPool* poolp) {
+    EmitCConstPool(const AstConstPool* poolp, bool release)
+        : m_release{release} {
         emitVars(poolp);
         V3Stats::addStatSum("ConstPool, Tables emitted", m_tablesEmitted);
         V3Stats::addStatSum("ConstPool, Constants emitted", m_constsEmitted);
@@ -113,7 +118,8 @@ public:
 //######################################################################
 // EmitC static functions
 
-void V3EmitC::emitcConstPool() {
+void V3EmitC::emitcConstPool(bool release) {
     UINFO(2, __FUNCTION__ << ":");
-    EmitCConstPool(v3Global.rootp()->constPoolp());
+    EmitCConstPool(v3Global.rootp()->constPoolp(), release);
+    if (v3Global.opt.stats()) V3Stats::statsStage("emit-constpool");
 }
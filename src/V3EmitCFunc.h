@@ -393,7 +393,7 @@ public:
         m_instantiatesOwnProcess = false;
         m_labelNumbers.clear();  // No need to save/restore, all Jumps must be within the function
 
-        splitSizeInc(nodep);
+        splitSizeInc(compileCost(nodep));
 
         puts("\n");
         m_lazyDecls.emit(nodep);
@@ -1500,6 +1500,14 @@ public:
         // Widths match up already, so we'll just use C++'s operator w/o any temps.
         if (nodep->thenp()->isWide()) {
             emitOpName(nodep, nodep->emitC(), nodep->condp(), nodep->thenp(), nodep->elsep());
+        } else if (nodep->branchless()) {
+            putns(nodep, nodep->isQuad() ? "VL_CONDMASK_Q(" : "VL_CONDMASK_I(");
+            iterateAndNextConstNull(nodep->condp());
+            puts(", ");
+            iterateAndNextConstNull(nodep->thenp());
+            puts(", ");
+            iterateAndNextConstNull(nodep->elsep());
+            puts(")");
         } else {
             putnbs(nodep, "(");
             iterateAndNextConstNull(nodep->condp());
@@ -1658,6 +1666,14 @@ public:
         }
         // ArraySel or WordSel
         iterateAndNextConstNull(nodep->fromp());
+        const AstVarRef* const refp = VN_CAST(nodep->fromp(), VarRef);
+        if (refp && refp->varp()->attrSparse() && refp->access().isReadOnly()) {
+            // Read sparse array without allocating storage
+            puts(".read(");
+            iterateAndNextConstNull(nodep->bitp());
+            puts(")");
+            return;
+        }
         // Special case constant index for readability
         if (AstConst* const idxp = VN_CAST(nodep->bitp(), Const)) {
             puts("[" + std::to_string(idxp->toUInt()) + "U]");
@@ -18,6 +18,7 @@
 
 #include "V3EmitC.h"
 #include "V3EmitCFunc.h"
+#include "V3Stats.h"
 #include "V3ThreadPool.h"
 #include "V3UniqueNames.h"
 
@@ -392,6 +393,12 @@ class EmitCImp final : public EmitCFunc {
             closeOutputFile();
         }
     }
+    // Predicate to check if the given function is emitted by this class
+    static bool isImpFunc(const AstCFunc* funcp) {
+        // TRACE_* and DPI handled elsewhere
+        return !funcp->isTrace() && !funcp->dpiImportPrototype()
+               && !funcp->dpiExportDispatcher();
+    }
     void emitCFuncImp(const AstNodeModule* modp) {
         // Functions to be emitted here
         std::vector<AstCFunc*> funcps;
@@ -400,10 +407,7 @@ class EmitCImp final : public EmitCFunc {
             for (AstNode* nodep = modp->stmtsp(); nodep; nodep = nodep->nextp()) {
                 AstCFunc* const funcp = VN_CAST(nodep, CFunc);
                 if (!funcp) continue;
-                // TRACE_* and DPI handled elsewhere
-                if (funcp->isTrace()) continue;
-                if (funcp->dpiImportPrototype()) continue;
-                if (funcp->dpiExportDispatcher()) continue;
+                if (!isImpFunc(funcp)) continue;
                 if (funcp->slow() != m_slow) continue;
                 funcps.push_back(funcp);
             }
@@ -470,6 +474,29 @@ public:
         EmitCImp emitCImp{modp, slow};
         return emitCImp.getAndClearCfileps();
     }
+    // Delete the bodies of the functions emitted for the given module. Must only be called
+    // after both the slow and fast files of the module have been written.
+    static void release(const AstNodeModule* modp) VL_MT_DISABLED {
+        size_t released = 0;
+        const auto releaseFuncs = [&released](const AstNodeModule* modp) {
+            for (AstNode* nodep = modp->stmtsp(); nodep; nodep = nodep->nextp()) {
+                AstCFunc* const funcp = VN_CAST(nodep, CFunc);
+                if (!funcp || !isImpFunc(funcp)) continue;
+                for (AstNode *stmtp = funcp->stmtsp(), *nextp; stmtp; stmtp = nextp) {
+                    nextp = stmtp->nextp();
+                    // Keep what other functions might point to, e.g.: coverage declarations
+                    if (stmtp->maybePointedTo()) continue;
+                    VL_DO_DANGLING(stmtp->unlinkFrBack()->deleteTree(), stmtp);
+                }
+                ++released;
+            }
+        };
+        releaseFuncs(modp);
+        if (const AstClassPackage* const packagep = VN_CAST(modp, ClassPackage)) {
+            releaseFuncs(packagep->classp());
+        }
+        V3Stats::addStatSum("Emit, Function bodies released", released);
+    }
 };
 
 //######################################################################
@@ -879,40 +906,59 @@ public:
 //######################################################################
 // EmitC class functions
 
-void V3EmitC::emitcImp() {
+void V3EmitC::emitcImp(bool release) {
     UINFO(2, __FUNCTION__ << ":");
+    // Make parent module pointers available.
+    const EmitCParentModule emitCParentModule;
+    std::vector<const AstNodeModule*> modps;
+    for (const AstNode* nodep = v3Global.rootp()->modulesp(); nodep; nodep = nodep->nextp()) {
+        if (VN_IS(nodep, Class)) continue;  // Imped with ClassPackage
+        modps.push_back(VN_AS(nodep, NodeModule));
+    }
+    // When releasing, emit modules in batches, and release each batch from the main thread
+    // once it has been written, as deleting Ast nodes is not thread safe
+    const size_t batchSize
+        = release ? std::max<size_t>(4 * v3Global.opt.verilateJobs(), 1) : modps.size();
     std::list<std::vector<AstCFile*>> cfiles;
-    {
-        // Make parent module pointers available.
-        const EmitCParentModule emitCParentModule;
-        V3ThreadScope threadScope;
-
-        // Process each module in turn
-        for (const AstNode* nodep = v3Global.rootp()->modulesp(); nodep; nodep = nodep->nextp()) {
-            if (VN_IS(nodep, Class)) continue;  // Imped with ClassPackage
-            const AstNodeModule* const modp = VN_AS(nodep, NodeModule);
-            cfiles.emplace_back();
-            std::vector<AstCFile*>& slow = cfiles.back();
-            threadScope.enqueue([modp, &slow] { slow = EmitCImp::main(modp, /* slow: */ true); });
-            cfiles.emplace_back();
-            std::vector<AstCFile*>& fast = cfiles.back();
-            threadScope.enqueue([modp, &fast] { fast = EmitCImp::main(modp, /* slow: */ false); });
-        }
-
-        // Emit trace routines (currently they can only exist in the top module)
-        if (v3Global.opt.trace() && !v3Global.opt.lintOnly()) {
-            cfiles.emplace_back();
-            std::vector<AstCFile*>& slow = cfiles.back();
-            threadScope.enqueue([&slow] { slow = EmitCTrace::main(/* slow: */ true); });
-            cfiles.emplace_back();
-            std::vector<AstCFile*>& fast = cfiles.back();
-            threadScope.enqueue([&fast] { fast = EmitCTrace::main(/* slow: */ false); });
+    size_t next = 0;
+    do {
+        const size_t end = std::min(next + batchSize, modps.size());
+        {
+            V3ThreadScope threadScope;
+
+            // Process each module in turn
+            for (size_t i = next; i < end; ++i) {
+                const AstNodeModule* const modp = modps[i];
+                cfiles.emplace_back();
+                std::vector<AstCFile*>& slow = cfiles.back();
+                threadScope.enqueue(
+                    [modp, &slow] { slow = EmitCImp::main(modp, /* slow: */ true); });
+                cfiles.emplace_back();
+                std::vector<AstCFile*>& fast = cfiles.back();
+                threadScope.enqueue(
+                    [modp, &fast] { fast = EmitCImp::main(modp, /* slow: */ false); });
+            }
+
+            // Emit trace routines (currently they can only exist in the top module)
+            if (end == modps.size() && v3Global.opt.trace() && !v3Global.opt.lintOnly()) {
+                cfiles.emplace_back();
+                std::vector<AstCFile*>& slow = cfiles.back();
+                threadScope.enqueue([&slow] { slow = EmitCTrace::main(/* slow: */ true); });
+                cfiles.emplace_back();
+                std::vector<AstCFile*>& fast = cfiles.back();
+                threadScope.enqueue([&fast] { fast = EmitCTrace::main(/* slow: */ false); });
+            }
         }
-    }
+        if (release) {
+            for (size_t i = next; i < end; ++i) EmitCImp::release(modps[i]);
+        }
+        next = end;
+    } while (next < modps.size());
     // Add files to netlist
     for (const std::vector<AstCFile*>& cfileps : cfiles) {
         for (AstCFile* const cfilep : cfileps) v3Global.rootp()->addFilesp(cfilep);
     }
+    if (v3Global.opt.stats()) V3Stats::statsStage("emit-imp");
 }
 
 void V3EmitC::emitcFiles() {
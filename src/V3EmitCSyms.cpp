@@ -835,6 +835,14 @@ std::vector<std::string> EmitCSyms::getSymCtorStmts() {
             stmt += bounds;
             stmt += ");";
             add(stmt);
+
+            if (const AstVar* const flagp = varp->vpiChangedp()) {
+                add(protect("__Vscopep_" + svd.m_scopeName) + "->varChangedFlag(\""
+                    + V3OutFormatter::quoteNameControls(protect(svd.m_varBasePretty))
+                    + "\", &("
+                    + VIdProtect::protectIf(scopep->nameDotless(), scopep->protect()) + "."
+                    + protect(flagp->name()) + "));");
+            }
         }
     }
 
@@ -498,7 +498,29 @@ public:
         ++m_putClassCount;
     }
 
+    static void predictBuild() {
+        // The complexity scores are estimates of compile cost. With any reasonable scheduling
+        // of --build-jobs compile jobs, the build takes at least as long as the largest file,
+        // and at least as long as the total cost shared evenly between the jobs.
+        uint64_t totalScore = 0;
+        uint64_t largestScore = 0;
+        for (AstNodeFile* nodep = v3Global.rootp()->filesp(); nodep;
+             nodep = VN_AS(nodep->nextp(), NodeFile)) {
+            const AstCFile* const cfilep = VN_CAST(nodep, CFile);
+            if (!cfilep || !cfilep->source()) continue;
+            totalScore += cfilep->complexityScore();
+            largestScore = std::max(largestScore, cfilep->complexityScore());
+        }
+        const uint64_t jobs = std::max(v3Global.opt.buildJobs(), 1);
+        const uint64_t criticalScore = std::max(largestScore, (totalScore + jobs - 1) / jobs);
+        V3Stats::addStat("Build prediction, compile cost, total", totalScore);
+        V3Stats::addStat("Build prediction, compile cost, largest file", largestScore);
+        V3Stats::addStat("Build prediction, compile cost, critical path", criticalScore);
+    }
+
     void emitClassMake() {
+        if (v3Global.opt.stats()) predictBuild();
+
         std::vector<FileOrConcatenatedFilesList> vmClassesSlowList;
         std::vector<FileOrConcatenatedFilesList> vmClassesFastList;
         if (v3Global.opt.outputGroups() > 0) {
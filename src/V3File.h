@@ -333,6 +333,9 @@ public:
     V3OutJsonFile& put(const std::string& name, int value) {
         return putNamed(name, std::to_string(value), false);
     }
+    V3OutJsonFile& put(const std::string& name, uint64_t value) {
+        return putNamed(name, std::to_string(value), false);
+    }
 
     // Put unnamed value
     V3OutJsonFile& put(const std::string& value) { return putNamed("", value, true); }
@@ -310,6 +310,7 @@ class GateBuildVisitor final : public VNVisitorConst {
 
 public:
     static std::unique_ptr<GateGraph> apply(AstNetlist* netlistp) {
+        const V3StatsTimer statsTimer{"GateBuildVisitor"};
         return std::unique_ptr<GateGraph>{GateBuildVisitor{netlistp}.m_graphp};
     }
 };
@@ -791,7 +792,10 @@ class GateInline final {
     }
 
 public:
-    static void apply(GateGraph& graph) { GateInline{graph}; }
+    static void apply(GateGraph& graph) {
+        const V3StatsTimer statsTimer{"GateInline"};
+        GateInline{graph};
+    }
 };
 
 //######################################################################
@@ -1088,7 +1092,10 @@ class GateDedupe final {
     ~GateDedupe() { V3Stats::addStat("Optimizations, Gate sigs deduped", m_statDedupLogic); }
 
 public:
-    static void apply(GateGraph& graph) { GateDedupe{graph}; }
+    static void apply(GateGraph& graph) {
+        const V3StatsTimer statsTimer{"GateDedupe"};
+        GateDedupe{graph};
+    }
 };
 
 //######################################################################
@@ -1194,7 +1201,10 @@ class GateMergeAssignments final {
     }
 
 public:
-    static void apply(GateGraph& graph) { GateMergeAssignments{graph}; }
+    static void apply(GateGraph& graph) {
+        const V3StatsTimer statsTimer{"GateMergeAssignments"};
+        GateMergeAssignments{graph};
+    }
 };
 
 //######################################################################
@@ -1262,7 +1272,10 @@ class GateUnused final {
     }
 
 public:
-    static void apply(GateGraph& graph) { GateUnused{graph}; }
+    static void apply(GateGraph& graph) {
+        const V3StatsTimer statsTimer{"GateUnused"};
+        GateUnused{graph};
+    }
 };
 
 //######################################################################
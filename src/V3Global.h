@@ -131,6 +131,8 @@ class V3Global final {
     bool m_useRandSequence = false;  // Has `randsequence`
     bool m_useRandomizeMethods = false;  // Need to define randomize() class methods
     uint64_t m_currentHierBlockCost = 0;  // Total cost of this hier block, used for scheduling
+    // Names of --lib-create outputs not combinationally dependent on data inputs
+    std::unordered_set<std::string> m_libRegisteredOutputs;
 
     // Memory address to short string mapping (for debug)
     std::unordered_map<const void*, std::string>
@@ -220,6 +222,10 @@ public:
     static std::vector<std::string> verilatedCppFiles();
     uint64_t currentHierBlockCost() const { return m_currentHierBlockCost; }
     void currentHierBlockCost(uint64_t cost) { m_currentHierBlockCost = cost; }
+    const std::unordered_set<std::string>& libRegisteredOutputs() const {
+        return m_libRegisteredOutputs;
+    }
+    void addLibRegisteredOutput(const std::string& name) { m_libRegisteredOutputs.insert(name); }
 };
 
 extern V3Global v3Global;
@@ -95,6 +95,10 @@
 #include "V3Stats.h"
 #include "V3String.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -111,6 +115,29 @@ static string V3HierParametersFileName(const string& prefix) {
     return v3Global.opt.makeDir() + "/" + prefix + "__hierParameters.v";
 }
 
+// Copy files of a block's output directory, sources before objects before
+// libraries, so the copies are not older than what they were made from.
+// Dependency files are not copied, as they contain absolute paths.
+static bool V3HierCopyBlockFiles(const string& fromDir, const string& toDir) {
+    std::vector<string> names = V3Os::filesInDir(fromDir);
+    if (names.empty()) return false;
+    const auto order = [](const string& name) {
+        const string ext = V3Os::filenameExt(name);
+        return ext == ".a" ? 2 : ext == ".o" ? 1 : 0;
+    };
+    std::stable_sort(names.begin(), names.end(), [&](const string& a, const string& b) {
+        return order(a) < order(b);
+    });
+    V3Os::createDir(toDir);
+    for (const string& name : names) {
+        if (V3Os::filenameExt(name) == ".d") continue;
+        std::ifstream is{fromDir + "/" + name, std::ios::binary};
+        std::ofstream os{toDir + "/" + name, std::ios::binary | std::ios::trunc};
+        if (!is || !os || !(os << is.rdbuf())) return false;
+    }
+    return true;
+}
+
 static void V3HierWriteCommonInputs(const V3HierBlock* hblockp, std::ostream* of, bool forMkJson) {
     string topModuleFile;
     if (hblockp) topModuleFile = hblockp->vFileIfNecessary();
@@ -214,7 +241,7 @@ VStringList V3HierBlock::hierBlockArgs() const {
     return opts;
 }
 
-string V3HierBlock::hierPrefix() const { return "V" + modp()->name(); }
+string V3HierBlock::hierPrefix() const { return m_prefix; }
 
 string V3HierBlock::hierSomeFilename(bool withDir, const char* prefix, const char* suffix) const {
     string s;
@@ -278,23 +305,76 @@ string V3HierBlock::typeParametersFilename() const {
     return V3HierParametersFileName(hierPrefix());
 }
 
-void V3HierBlock::writeParametersFile() const {
-    if (m_typeParams.empty()) return;
-
+void V3HierBlock::writeParameters(std::ostream& os) const {
     VHashSha256 hash{"type params"};
     const string moduleName = "Vhsh" + hash.digestSymbol();
-    const std::unique_ptr<std::ofstream> of{V3File::new_ofstream(typeParametersFilename())};
-    *of << "module " << moduleName << ";\n";
+    os << "module " << moduleName << ";\n";
     for (AstParamTypeDType* const gparam : m_typeParams) {
         AstTypedef* tdefp
             = new AstTypedef{new FileLine{FileLine::builtInFilename()}, gparam->name(), nullptr,
                              VFlagChildDType{}, gparam->skipRefp()->cloneTreePure(true)};
-        V3EmitV::verilogForTree(tdefp, *of);
+        V3EmitV::verilogForTree(tdefp, os);
         VL_DO_DANGLING(tdefp->deleteTree(), tdefp);
     }
-    *of << "endmodule\n\n";
-    *of << "`verilator_config\n";
-    *of << "hier_params -module \"" << moduleName << "\"\n";
+    os << "endmodule\n\n";
+    os << "`verilator_config\n";
+    os << "hier_params -module \"" << moduleName << "\"\n";
+}
+
+void V3HierBlock::writeParametersFile() const {
+    if (m_typeParams.empty()) return;
+    const std::unique_ptr<std::ofstream> of{V3File::new_ofstream(typeParametersFilename())};
+    writeParameters(*of);
+}
+
+void V3HierBlock::computeCacheKey() {
+    // Only what the child Verilation of this block depends on, so different
+    // designs and output directories can share blocks. Not the C++ compiler.
+    VHashSha256 hash{"Verilator hierarchical block " + V3Options::version()};
+    hash.insert(V3Options::getenvVERILATOR_ROOT() + "\n");
+    for (const string& opt : commandArgs(false)) {
+        // The file is in the output directory, its contents are hashed below
+        if (VString::startsWith(opt, " --hierarchical-params-file ")) continue;
+        hash.insert(opt + "\n");
+    }
+    hash.insert(hierBlockArgs().front() + "\n");
+    for (const V3GraphEdge& edge : outEdges()) {
+        const V3HierBlock* const dependencyp = edge.top()->as<V3HierBlock>();
+        UASSERT_OBJ(!dependencyp->cacheKey().empty(), m_modp, "Dependency key not computed");
+        hash.insert(dependencyp->cacheKey() + "\n");
+    }
+    hash.insert(v3Global.opt.allArgsStringForHierBlock(false, true) + "\n");
+    if (!m_typeParams.empty()) {
+        std::ostringstream os;
+        writeParameters(os);
+        hash.insert(os.str());
+    }
+    // Source files of the modules under this block, up to other blocks, and
+    // conservatively of all packages, classes and interfaces
+    std::set<string> filenames;
+    std::unordered_set<const AstNodeModule*> visited;
+    const std::function<void(const AstNodeModule*)> addModule = [&](const AstNodeModule* modp) {
+        if (!visited.insert(modp).second) return;
+        modp->foreach([&](const AstNode* nodep) {
+            filenames.insert(nodep->fileline()->filename());
+            if (const AstCell* const cellp = VN_CAST(nodep, Cell)) {
+                if (!cellp->modp()->hierBlock()) addModule(cellp->modp());
+            }
+        });
+    };
+    addModule(m_modp);
+    for (const AstNode* nodep = v3Global.rootp()->modulesp(); nodep; nodep = nodep->nextp()) {
+        if (!VN_IS(nodep, Module)) addModule(VN_AS(nodep, NodeModule));
+    }
+    // Names as well as contents, as names appear in the generated code.
+    // Built-in and command line filenames do not exist and are skipped.
+    for (const string& filename : filenames) {
+        hash.insert(filename + "\n");
+        hash.insertFile(filename);
+        hash.insert("\n");
+    }
+    m_cacheKey = hash.digestHex();
+    UINFO(4, "Hierarchical block cache key " << m_cacheKey << " for " << hierPrefix());
 }
 
 //######################################################################
@@ -435,6 +515,47 @@ void V3HierGraph::writeCommandArgsFiles(bool forMkJson) const {
     *of << v3Global.opt.allArgsStringForHierBlock(true) << "\n";
 }
 
+void V3HierGraph::restoreCachedBlocks() {
+    const string cacheDir = v3Global.opt.hierCacheDir();
+    if (cacheDir.empty()) return;
+    size_t hits = 0;
+    // Dependencies first, so their libraries are not newer than the users'
+    for (auto it = vertices().rbegin(); it != vertices().rend(); ++it) {
+        V3HierBlock* const blockp = (*it).as<V3HierBlock>();
+        const string entryDir = cacheDir + "/" + blockp->cacheKey();
+        const string blockDir = v3Global.opt.makeDir() + "/" + blockp->hierPrefix();
+        if (!V3HierCopyBlockFiles(entryDir, blockDir)) continue;
+        UINFO(1, "Restored hierarchical block " << blockp->hierPrefix() << " from " << entryDir);
+        blockp->cacheHit(true);
+        ++hits;
+    }
+    V3Stats::addStat("HierBlock, Blocks from cache", hits);
+}
+
+void V3HierGraph::storeCachedBlocks() const {
+    const string cacheDir = v3Global.opt.hierCacheDir();
+    if (cacheDir.empty()) return;
+    V3Os::createDir(cacheDir);
+    for (const V3GraphVertex& vtx : vertices()) {
+        const V3HierBlock* const blockp = vtx.as<V3HierBlock>();
+        if (blockp->cacheHit()) continue;
+        // Copy to a temporary name, then rename as a whole, so concurrent
+        // builds never see a partial entry. If another build stored the
+        // same entry meanwhile, the rename fails and the copy is discarded.
+        const string entryDir = cacheDir + "/" + blockp->cacheKey();
+        const string tmpDir
+            = entryDir + "__tmp" + VHashSha256{V3Os::trueRandom(16)}.digestHex().substr(0, 16);
+        const string blockDir = v3Global.opt.makeDir() + "/" + blockp->hierPrefix();
+        if (V3HierCopyBlockFiles(blockDir, tmpDir)
+            && !std::rename(tmpDir.c_str(), entryDir.c_str())) {
+            UINFO(1, "Stored hierarchical block " << blockp->hierPrefix() << " to " << entryDir);
+            continue;
+        }
+        V3Os::unlinkRegexp(tmpDir, "*");
+        std::remove(tmpDir.c_str());
+    }
+}
+
 string V3HierGraph::topCommandArgsFilename(bool forMkJson) {
     return V3HierCommandArgsFilename(v3Global.opt.prefix(), forMkJson);
 }
@@ -463,6 +584,12 @@ void V3Hierarchical::createGraph(AstNetlist* netlistp) {
         VL_DO_DANGLING(delete graphp, graphp);
         return;
     }
+    if (!v3Global.opt.hierCacheDir().empty()) {
+        // Dependencies first, as their keys are part of their users' keys
+        for (auto it = graphp->vertices().rbegin(); it != graphp->vertices().rend(); ++it) {
+            (*it).as<V3HierBlock>()->computeCacheKey();
+        }
+    }
     // Hold on to the graph
     v3Global.hierGraphp(graphp);
 }
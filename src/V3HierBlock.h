@@ -48,6 +48,10 @@ public:
     void writeCommandArgsFiles(bool forMkJson) const VL_MT_DISABLED;
     void writeParametersFiles() const VL_MT_DISABLED;
     static string topCommandArgsFilename(bool forMkJson) VL_MT_DISABLED;
+    // Copy blocks found in --hierarchical-cache into the output directory
+    void restoreCachedBlocks() VL_MT_DISABLED;
+    // Add blocks not found in --hierarchical-cache to the cache
+    void storeCachedBlocks() const VL_MT_DISABLED;
 };
 
 class V3HierBlock final : public V3GraphVertex {
@@ -60,14 +64,18 @@ class V3HierBlock final : public V3GraphVertex {
 
     // MEMBERS
     const AstModule* const m_modp;  // Hierarchical block module
+    const string m_prefix;  // Prefix of the block's model, kept after the netlist is released
     // Value parameters that are overridden by #(.param(value)) syntax.
     const std::vector<AstVar*> m_params;
     // Types parameters that are overridden by #(.param(value)) syntax.
     const std::vector<AstParamTypeDType*> m_typeParams;
+    string m_cacheKey;  // Key of the block in --hierarchical-cache
+    bool m_cacheHit = false;  // Restored from --hierarchical-cache
 
     // METHODS
     static StrGParams stringifyParams(const std::vector<AstVar*>& params,
                                       bool forGOption) VL_MT_DISABLED;
+    void writeParameters(std::ostream& os) const VL_MT_DISABLED;
 
 public:
     // CONSTRUCTORs
@@ -75,6 +83,7 @@ public:
                 const std::vector<AstParamTypeDType*>& typeParams)
         : V3GraphVertex{graphp}
         , m_modp{modp}
+        , m_prefix{"V" + modp->name()}
         , m_params{params}
         , m_typeParams{typeParams} {}
     ~V3HierBlock() VL_MT_DISABLED = default;
@@ -101,6 +110,12 @@ public:
     string commandArgsFilename(bool forMkJson) const VL_MT_DISABLED;
     string typeParametersFilename() const VL_MT_DISABLED;
 
+    // For --hierarchical-cache
+    void computeCacheKey() VL_MT_DISABLED;
+    string cacheKey() const { return m_cacheKey; }
+    bool cacheHit() const { return m_cacheHit; }
+    void cacheHit(bool flag) { m_cacheHit = flag; }
+
     // For Graphviz dumps only
     std::string name() const override { return m_modp->prettyNameQ(); }
     std::string dotShape() const override { return "box"; }
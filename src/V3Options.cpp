@@ -430,7 +430,7 @@ string V3Options::allArgsString() const VL_MT_SAFE {
 }
 
 // Delete some options for Verilation of the hierarchical blocks.
-string V3Options::allArgsStringForHierBlock(bool forTop) const {
+string V3Options::allArgsStringForHierBlock(bool forTop, bool forCacheKey) const {
     // cppcheck-suppress shadowFunction
     std::set<string> vFiles;
     for (const auto& vFile : m_vFiles) vFiles.insert(vFile.filename());
@@ -454,7 +454,8 @@ string V3Options::allArgsStringForHierBlock(bool forTop) const {
         }
         if (skip > 0) {  // arg is an option
             const string opt = arg.substr(skip);  // Remove '-' in the beginning
-            const int numStrip = stripOptionsForChildRun(opt, forTop);
+            int numStrip = stripOptionsForChildRun(opt, forTop);
+            if (!numStrip && forCacheKey) numStrip = stripOptionsForCacheKey(opt);
             if (numStrip) {
                 UASSERT(0 <= numStrip && numStrip <= 3, "should be one of 0, 1, 2, 3");
                 if (numStrip == 2) stripArg = true;
@@ -622,6 +623,7 @@ int V3Options::stripOptionsForChildRun(const string& opt, bool forTop) {
         //
         {"build", 1},
         {"hierarchical", 1},
+        {"hierarchical-cache", 2},
     };
     if (commonOpts.count(opt)) return commonOpts.at(opt);
 
@@ -642,6 +644,18 @@ int V3Options::stripOptionsForChildRun(const string& opt, bool forTop) {
     return 0;
 }
 
+int V3Options::stripOptionsForCacheKey(const string& opt) {
+    // Options passed to hier blocks, but only affecting the top
+    static const std::unordered_map<std::string, int> topOpts{
+        {"main", 1},
+        {"o", 2},
+        {"stats", 1},
+        {"top", 2},
+    };
+    if (topOpts.count(opt)) return topOpts.at(opt);
+    return 0;
+}
+
 void V3Options::validateIdentifier(FileLine* fl, const string& arg, const string& opt) {
     if (!VString::isIdentifier(arg)) {
         fl->v3error(opt << " argument must be a legal C++ identifier: '" << arg << "'");
@@ -1286,6 +1300,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     }).notForRerun();
 
     // Minus options
+    DECL_OPTION("-activity-gating", OnOff, &m_activityGating);
     DECL_OPTION("-aslr", CbOnOff, [](bool) {});  // Processed only in bin/verilator shell
     DECL_OPTION("-assert", CbOnOff, [this](bool flag) {
         m_assert = flag;
@@ -1440,6 +1455,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
 
     DECL_OPTION("-facyc-simp", FOnOff, &m_fAcycSimp);
     DECL_OPTION("-fassemble", FOnOff, &m_fAssemble);
+    DECL_OPTION("-fbranchless", FOnOff, &m_fBranchless);
     DECL_OPTION("-fcase", FOnOff, &m_fCase);
     DECL_OPTION("-fcombine", FOnOff, &m_fCombine);
     DECL_OPTION("-fconst", FOnOff, &m_fConst);
@@ -1518,6 +1534,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         const V3HierarchicalBlockOption opt{valp};
         m_hierBlocks.emplace(opt.mangledName(), opt);
     });
+    DECL_OPTION("-hierarchical-cache", Set, &m_hierCacheDir);
     DECL_OPTION("-hierarchical-child", Set, &m_hierChild);
     DECL_OPTION("-hierarchical-params-file", CbVal,
                 [this](const char* optp) { m_hierParamsFile.push_back({optp, work()}); });
@@ -1570,6 +1587,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         validateIdentifier(fl, valp, "--lib-create");
         m_libCreate = valp;
     });
+    DECL_OPTION("-lib-create-summary", OnOff, &m_libCreateSummary);
     DECL_OPTION("-lint-only", OnOff, &m_lintOnly);
     DECL_OPTION("-localize-max-size", Set, &m_localizeMaxSize);
 
@@ -1641,6 +1659,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_pinsScBigUint = flag;
         m_pinsBv = 513;
     });
+    DECL_OPTION("-pins-sc-lazy", OnOff, &m_pinsScLazy);
     DECL_OPTION("-pins-uint8", OnOff, &m_pinsUint8);
     DECL_OPTION("-pipe-filter", Set, &m_pipeFilter);
     DECL_OPTION("-pp-comments", OnOff, &m_preprocComments).undocumented();  // Renamed
@@ -1716,7 +1735,15 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_systemC = true;
     });
     DECL_OPTION("-skip-identical", OnOff, &m_skipIdentical);
+    DECL_OPTION("-sparse-threshold", CbVal, [this, fl](const char* valp) {
+        m_sparseThreshold = std::atoi(valp);
+        if (m_sparseThreshold < 0) fl->v3error("--sparse-threshold must be >= 0: " << valp);
+    });
     DECL_OPTION("-stats", OnOff, &m_stats);
+    DECL_OPTION("-stats-timeline", CbOnOff, [this](bool flag) {
+        m_statsTimeline = flag;
+        m_stats |= flag;
+    });
     DECL_OPTION("-stats-vars", CbOnOff, [this](bool flag) {
         m_statsVars = flag;
         m_stats |= flag;
@@ -1855,6 +1882,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         v3Global.vlExit(0);
     });
     DECL_OPTION("-vpi", OnOff, &m_vpi);
+    DECL_OPTION("-vpi-change-flags", OnOff, &m_vpiChangeFlags);
 
     DECL_OPTION("-Wall", CbCall, []() { FileLine::globalWarnOff(V3ErrorCode::I_LINT, false); });
     DECL_OPTION("-Werror-", CbPartialMatch, [this, fl](const char* optp) {
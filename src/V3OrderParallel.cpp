@@ -752,6 +752,7 @@ static void partInitHalfCriticalPaths(V3Graph& mTaskGraph, bool checkOnly) {
 
 // Look at vertex costs to form critical paths for each vertex.
 static void partInitCriticalPaths(V3Graph& mTaskGraph) {
+    const V3StatsTimer statsTimer{"partInitCriticalPaths"};
     partInitHalfCriticalPaths<GraphWay::FORWARD>(mTaskGraph, false);
     partInitHalfCriticalPaths<GraphWay::REVERSE>(mTaskGraph, false);
 
@@ -1107,6 +1108,62 @@ static void partRedirectEdgesFrom(V3Graph& graph, LogicMTask* recipientp, LogicM
     VL_DO_DANGLING(donorp->unlinkDelete(&graph), donorp);
 }
 
+//######################################################################
+// Chain merging
+
+// Merge each MTask into its predecessor, if that predecessor has no other dependents and the
+// MTask has no other dependencies. Such merges can never lengthen the critical path nor reduce
+// the available parallelism, so this cheaply coarsens the graph before Contraction, which
+// would otherwise need to score and merge each of these edges individually. As in Contraction,
+// the entry and exit MTasks are left alone, and no MTask grows beyond 'cpLimit', so long
+// chains are split into pieces that can still be scheduled in the gaps of other threads.
+static void partMergeChains(V3Graph& mTaskGraph, uint64_t cpLimit, LogicMTask* entryMTaskp,
+                            LogicMTask* exitMTaskp) {
+    const V3StatsTimer statsTimer{"partMergeChains"};
+
+    // Whether 'mtaskp' should absorb its only dependent
+    const auto canAbsorbNext = [&](const LogicMTask* mtaskp) {
+        if (mtaskp == entryMTaskp || !mtaskp->outSize1()) return false;
+        const V3GraphVertex* const nextp = mtaskp->outEdges().frontp()->top();
+        return nextp != exitMTaskp && nextp->inSize1();
+    };
+
+    // Find the heads of the chains first. Merging only ever deletes non-head MTasks.
+    std::vector<LogicMTask*> headps;
+    for (V3GraphVertex& vtx : mTaskGraph.vertices()) {
+        LogicMTask* const mtaskp = vtx.as<LogicMTask>();
+        if (!canAbsorbNext(mtaskp)) continue;
+        if (mtaskp->inSize1()) {
+            const LogicMTask* const prevp = mtaskp->inEdges().frontp()->fromp()->as<LogicMTask>();
+            if (canAbsorbNext(prevp)) continue;  // Not a head, will be absorbed by 'prevp'
+        }
+        headps.push_back(mtaskp);
+    }
+
+    // Absorb the rest of each chain into its head, starting a new head when the limit is reached
+    size_t nMerged = 0;
+    for (LogicMTask* mtaskp : headps) {
+        while (canAbsorbNext(mtaskp)) {
+            MTaskEdge* const edgep = mtaskp->outEdges().frontp()->as<MTaskEdge>();
+            LogicMTask* const nextp = edgep->toMTaskp();
+            if (mtaskp->cost() + nextp->cost() > cpLimit) {
+                mtaskp = nextp;
+                continue;
+            }
+            // Remove the connecting edge
+            mtaskp->removeRelativeMTask(nextp);
+            mtaskp->removeRelativeEdge<GraphWay::FORWARD>(edgep);
+            nextp->removeRelativeEdge<GraphWay::REVERSE>(edgep);
+            VL_DO_DANGLING(edgep->unlinkDelete(), edgep);
+            // Merge, this also deletes 'nextp'
+            mtaskp->moveAllVerticesFrom(nextp);
+            partRedirectEdgesFrom(mTaskGraph, mtaskp, nextp, nullptr);
+            ++nMerged;
+        }
+    }
+    V3Stats::addStat("MTask graph, chain merges", nMerged);
+}
+
 //######################################################################
 // Contraction
 
@@ -1700,6 +1757,7 @@ public:
 
     static void apply(V3Graph& mTaskGraph, uint64_t scoreLimit, LogicMTask* entryMTaskp,
                       LogicMTask* exitMTaskp, bool slowAsserts) {
+        const V3StatsTimer statsTimer{"Contraction"};
         Contraction{mTaskGraph, scoreLimit, entryMTaskp, exitMTaskp, slowAsserts};
     }
 };
@@ -1717,8 +1775,10 @@ class DpiImportCallVisitor final : public VNVisitor {
         if (!m_tracingCall) return;
         m_tracingCall = false;
         if (nodep->dpiImportWrapper()) {
-            if (nodep->dpiPure() ? !v3Global.opt.threadsDpiPure()
-                                 : !v3Global.opt.threadsDpiUnpure()) {
+            // Imports declared thread-safe are treated as pure, only data
+            // dependencies order their calls
+            const bool threadSafe = nodep->dpiPure() || nodep->dpiThreadSafe();
+            if (threadSafe ? !v3Global.opt.threadsDpiPure() : !v3Global.opt.threadsDpiUnpure()) {
                 // If hierarchical DPI wrapper cost is not found or is of a 0 cost,
                 // we have a normal DPI which induces DPI hazard by default.
                 m_hasDpiHazard = V3Control::getProfileData(nodep->cname()) == 0;
@@ -2052,6 +2112,7 @@ class FixDataHazards final {
 
 public:
     static void apply(const OrderGraph& orderGraph, V3Graph& mTaskGraph) {
+        const V3StatsTimer statsTimer{"FixDataHazards"};
         FixDataHazards(orderGraph, mTaskGraph);
     }
 };
@@ -2195,6 +2256,7 @@ class Partitioner final {
     }
 
     uint64_t setupMTaskDeps() VL_MT_DISABLED {
+        const V3StatsTimer statsTimer{"Partitioner::setupMTaskDeps"};
         uint64_t totalGraphCost = 0;
 
         // Artificial single entry point vertex in the MTask graph to allow sibling merges.
@@ -2303,6 +2365,27 @@ class Partitioner final {
         debugMTaskGraphStats(*m_mTaskGraphp, "hazards");
         hashGraphDebug(*m_mTaskGraphp, "mTaskGraphpp after fixDataHazards()");
 
+        const int targetParFactor = v3Global.opt.threads();
+        UASSERT(targetParFactor >= 2, "Should not reach Partitioner when --threads <= 1");
+
+        // Set cpLimit to roughly totalGraphCost / nThreads
+        //
+        // Actually set it a bit lower, by a hardcoded fudge factor. This
+        // results in more smaller mTaskGraphp, which helps reduce fragmentation
+        // when scheduling them.
+        const unsigned fudgeNumerator = 3;
+        const unsigned fudgeDenominator = 5;
+        const uint64_t cpLimit
+            = ((totalGraphCost * fudgeNumerator) / (targetParFactor * fudgeDenominator));
+        UINFO(4, "Partitioner set cpLimit = " << cpLimit);
+
+        // Merge serial chains of MTasks. This is exact and much cheaper than Contraction.
+        if (v3Global.opt.threadsCoarsen()) {
+            partMergeChains(*m_mTaskGraphp, cpLimit, m_entryMTaskp, m_exitMTaskp);
+            debugMTaskGraphStats(*m_mTaskGraphp, "chains");
+            hashGraphDebug(*m_mTaskGraphp, "mTaskGraphpp after partMergeChains()");
+        }
+
         // Setup the critical path into and out of each node.
         partInitCriticalPaths(*m_mTaskGraphp);
         hashGraphDebug(*m_mTaskGraphp, "after partInitCriticalPaths()");
@@ -2327,20 +2410,6 @@ class Partitioner final {
         // Some tests disable this, hence the test on threadsCoarsen().
         // Coarsening is always enabled in production.
         if (v3Global.opt.threadsCoarsen()) {
-            const int targetParFactor = v3Global.opt.threads();
-            UASSERT(targetParFactor >= 2, "Should not reach Partitioner when --threads <= 1");
-
-            // Set cpLimit to roughly totalGraphCost / nThreads
-            //
-            // Actually set it a bit lower, by a hardcoded fudge factor. This
-            // results in more smaller mTaskGraphp, which helps reduce fragmentation
-            // when scheduling them.
-            const unsigned fudgeNumerator = 3;
-            const unsigned fudgeDenominator = 5;
-            const uint64_t cpLimit
-                = ((totalGraphCost * fudgeNumerator) / (targetParFactor * fudgeDenominator));
-            UINFO(4, "Partitioner set cpLimit = " << cpLimit);
-
             Contraction::apply(*m_mTaskGraphp, cpLimit, m_entryMTaskp, m_exitMTaskp,
                                // --debugPartition is used by tests
                                // to enable slow assertions.
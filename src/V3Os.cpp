@@ -37,6 +37,7 @@
 VL_DEFINE_DEBUG_FUNCTIONS;
 #endif
 
+#include <algorithm>
 #include <cerrno>
 #include <climits>  // PATH_MAX (especially on FreeBSD)
 #include <cstdarg>
@@ -406,6 +407,30 @@ void V3Os::unlinkRegexp(const string& dir, const string& regexp) {
 #endif
 }
 
+std::vector<string> V3Os::filesInDir(const string& dirname) {
+    std::vector<string> names;
+#ifdef _MSC_VER
+    try {
+        for (const auto& dirEntry : std::filesystem::directory_iterator(dirname.c_str())) {
+            if (dirEntry.is_regular_file()) names.push_back(dirEntry.path().filename().string());
+        }
+    } catch (std::filesystem::filesystem_error const& ex) {}
+#else
+    if (DIR* const dirp = opendir(dirname.c_str())) {
+        while (struct dirent* const direntp = readdir(dirp)) {
+            const string fullname = dirname + "/" + std::string{direntp->d_name};
+            struct stat sstat;
+            if (!stat(fullname.c_str(), &sstat) && S_ISREG(sstat.st_mode)) {
+                names.emplace_back(direntp->d_name);
+            }
+        }
+        closedir(dirp);
+    }
+#endif
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
 //######################################################################
 // METHODS (memory)
 
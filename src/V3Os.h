@@ -21,6 +21,7 @@
 #include "verilatedos.h"
 
 #include <array>
+#include <vector>
 
 // Limited V3 headers here - this is a base class for Vlc etc
 #include "V3Error.h"
@@ -70,6 +71,8 @@ public:
     static void filesystemFlush(const string& dirname);
     static void filesystemFlushBuildDir(const string& dirname);
     static void unlinkRegexp(const string& dir, const string& regexp);
+    ///< @return names of regular files in directory, sorted
+    static std::vector<string> filesInDir(const string& dirname);
 
     // METHODS (memory)
     static void releaseMemory();
@@ -21,11 +21,141 @@
 #include "V3Control.h"
 #include "V3Hasher.h"
 #include "V3InstrCount.h"
+#include "V3Stats.h"
 #include "V3String.h"
 #include "V3Task.h"
 
+#include <deque>
+
 VL_DEFINE_DEBUG_FUNCTIONS;
 
+//######################################################################
+// Find top level outputs that only change on clock edges. These outputs
+// are not combinationally dependent on any data input, that is any top
+// level input other than the ones used directly as a clock, so the
+// wrapper need not pass them through the combinational update.
+
+class ProtectRegisteredOutputsVisitor final {
+    // NODE STATE
+    //  AstVarScope::user1()    -> bool: Combinationally dependent on a data input
+    //  AstVarScope::user2()    -> bool: Used directly in a clock sensitivity
+    //  AstCFunc::user3()       -> bool: Already gathered for current logic (temporary)
+    const VNUser1InUse m_user1InUse;
+    const VNUser2InUse m_user2InUse;
+
+    // TYPES
+    struct Logic final {
+        std::vector<AstVarScope*> m_writes;  // Variables written, including by called functions
+        bool m_callsDpi = false;  // Calls a DPI import, which may call exports
+        bool m_done = false;  // Writes already marked dependent
+    };
+
+    // STATE
+    std::deque<Logic> m_logics;  // All logic
+    // Logic that runs when the variable changes
+    std::unordered_map<const AstVarScope*, std::vector<Logic*>> m_triggered;
+    std::vector<AstVarScope*> m_dpiWrittenps;  // Variables written by DPI exports
+    std::vector<AstVarScope*> m_pending;  // Dependent variables not yet propagated
+    VDouble0 m_statRegistered;  // Statistic tracking
+
+    // METHODS
+    void markDependent(AstVarScope* vscp) {
+        if (!vscp->user1SetOnce()) m_pending.push_back(vscp);
+    }
+
+    // Gather references of logic, following function calls
+    static void gather(AstNode* logicp, Logic& logic, std::vector<AstVarScope*>& reads) {
+        const VNUser3InUse user3InUse;
+        std::vector<AstNode*> todo{logicp};
+        while (!todo.empty()) {
+            AstNode* const nodep = todo.back();
+            todo.pop_back();
+            nodep->foreach([&](AstNode* subp) {
+                if (AstVarRef* const refp = VN_CAST(subp, VarRef)) {
+                    if (refp->access().isReadOrRW()) reads.push_back(refp->varScopep());
+                    if (refp->access().isWriteOrRW()) logic.m_writes.push_back(refp->varScopep());
+                } else if (AstNodeCCall* const callp = VN_CAST(subp, NodeCCall)) {
+                    AstCFunc* const funcp = callp->funcp();
+                    if (funcp->dpiImportWrapper()) logic.m_callsDpi = true;
+                    if (!funcp->user3SetOnce()) todo.push_back(funcp);
+                }
+            });
+        }
+    }
+
+    void addLogic(AstSenTree* sentreep, AstNode* logicp) {
+        m_logics.emplace_back();
+        Logic& logic = m_logics.back();
+        std::vector<AstVarScope*> reads;
+        gather(logicp, logic, reads);
+        const AstNodeProcedure* const procp = VN_CAST(logicp, NodeProcedure);
+        if (sentreep->hasClocked() && !sentreep->hasHybrid()
+            && !(procp && procp->isSuspendable())) {
+            // Only runs when its clocks change
+            reads.clear();
+            sentreep->foreach([&](AstVarRef* refp) { reads.push_back(refp->varScopep()); });
+        }
+        for (AstVarScope* const vscp : reads) m_triggered[vscp].push_back(&logic);
+    }
+
+public:
+    // CONSTRUCTORS
+    explicit ProtectRegisteredOutputsVisitor(AstNetlist* netlistp) {
+        // Clocks as the wrapper will see them
+        netlistp->foreach([](AstActive* activep) {
+            if (!activep->sentreep()->hasClocked()) return;
+            activep->sentreep()->foreach([](AstSenItem* itemp) {
+                if (!itemp->isClocked()) return;
+                if (AstVarRef* const refp = VN_CAST(itemp->sensp(), VarRef)) {
+                    refp->varScopep()->user2(true);
+                }
+            });
+        });
+        netlistp->foreach([&](AstActive* activep) {
+            if (activep->sentreep()->hasFinal()) return;
+            for (AstNode* logicp = activep->stmtsp(); logicp; logicp = logicp->nextp()) {
+                addLogic(activep->sentreep(), logicp);
+            }
+        });
+        netlistp->foreach([&](AstVarScope* vscp) {
+            if (vscp->varp()->isWrittenByDpi()) m_dpiWrittenps.push_back(vscp);
+        });
+
+        // Propagate from data inputs
+        AstScope* const topScopep = netlistp->topScopep()->scopep();
+        for (AstVarScope* vscp = topScopep->varsp(); vscp; vscp = VN_AS(vscp->nextp(), VarScope)) {
+            const AstVar* const varp = vscp->varp();
+            if (varp->isPrimaryIO() && varp->isNonOutput() && !vscp->user2()) markDependent(vscp);
+        }
+        while (!m_pending.empty()) {
+            AstVarScope* const vscp = m_pending.back();
+            m_pending.pop_back();
+            const auto it = m_triggered.find(vscp);
+            if (it == m_triggered.end()) continue;
+            for (Logic* const logicp : it->second) {
+                if (logicp->m_done) continue;
+                logicp->m_done = true;
+                for (AstVarScope* const writep : logicp->m_writes) markDependent(writep);
+                if (logicp->m_callsDpi) {
+                    for (AstVarScope* const writep : m_dpiWrittenps) markDependent(writep);
+                }
+            }
+        }
+
+        for (AstVarScope* vscp = topScopep->varsp(); vscp; vscp = VN_AS(vscp->nextp(), VarScope)) {
+            const AstVar* const varp = vscp->varp();
+            if (!varp->isPrimaryIO() || varp->direction() != VDirection::OUTPUT) continue;
+            if (vscp->user1()) continue;
+            UINFO(4, "Registered output " << varp);
+            v3Global.addLibRegisteredOutput(varp->name());
+            ++m_statRegistered;
+        }
+    }
+    ~ProtectRegisteredOutputsVisitor() {
+        V3Stats::addStat("Optimizations, Lib registered outputs", m_statRegistered);
+    }
+};
+
 //######################################################################
 // ProtectLib top-level visitor
 
@@ -48,6 +178,8 @@ class ProtectVisitor final : public VNVisitor {
     AstTextBlock* m_nbAssignsp = nullptr;  // Non-blocking assignment list
     AstTextBlock* m_seqAssignsp = nullptr;  // Sequential assignment list
     AstTextBlock* m_comboAssignsp = nullptr;  // Combo assignment list
+    AstTextBlock* m_initSeqParamsp = nullptr;  // Initial sequential parameter list
+    AstTextBlock* m_regAssignsp = nullptr;  // Registered output assignment list
     // C text blocks
     AstTextBlock* m_cHashValuep = nullptr;  // CPP hash value
     AstTextBlock* m_cComboParamsp = nullptr;  // Combo function parameter list
@@ -61,6 +193,7 @@ class ProtectVisitor final : public VNVisitor {
     const string m_topName;
     bool m_foundTop = false;  // Have seen the top module
     bool m_hasClk = false;  // True if the top module has sequential logic
+    bool m_hasRegistered = false;  // True if some outputs only change on clock edges
 
     // VISITORS
     void visit(AstNetlist* nodep) override {
@@ -82,6 +215,7 @@ class ProtectVisitor final : public VNVisitor {
         FileLine* const fl = nodep->fileline();
         // Need to know the existence of clk before createSvFile()
         m_hasClk = checkIfClockExists(nodep);
+        m_hasRegistered = m_hasClk && !v3Global.libRegisteredOutputs().empty();
         createSvFile(fl, nodep);
         createCppFile(fl);
 
@@ -247,6 +381,13 @@ class ProtectVisitor final : public VNVisitor {
         txtp->add("handle__V = " + m_libName
                   + "_protectlib_create"
                     "($sformatf(\"%m\"));\n");
+        if (m_hasRegistered) {
+            // Registered outputs are not updated by the combinational process
+            m_initSeqParamsp = new AstTextBlock{
+                fl, "void'(" + m_libName + "_protectlib_seq_update(\n", ",\n", "\n));\n"};
+            m_initSeqParamsp->add("handle__V");
+            txtp->add(m_initSeqParamsp);
+        }
         txtp->add("end\n\n");
 
         // Combinatorial process
@@ -300,6 +441,13 @@ class ProtectVisitor final : public VNVisitor {
             txtp->add(m_comboAssignsp);
         }
         txtp->add("end\n\n");
+        if (m_hasRegistered) {
+            addComment(txtp, fl, "Outputs that only change on clock edges");
+            txtp->add("always_comb begin\n");
+            m_regAssignsp = new AstTextBlock{fl};
+            txtp->add(m_regAssignsp);
+            txtp->add("end\n\n");
+        }
 
         // Final
         txtp->add("final " + m_libName + "_protectlib_final(handle__V);\n\n");
@@ -444,6 +592,7 @@ class ProtectVisitor final : public VNVisitor {
             const std::string pname = varp->prettyName();
             m_seqParamsp->add(pname);
             m_clkSensp->add(pname);
+            if (m_initSeqParamsp) m_initSeqParamsp->add(pname);
         }
         m_cSeqParamsp->add(varp->dpiArgType(true, false));
         m_cSeqClksp->add(cInputConnection(varp));
@@ -470,26 +619,39 @@ class ProtectVisitor final : public VNVisitor {
 
     void handleOutput(AstVar* const varp) {
         const std::string pname = varp->prettyName();
+        // Registered outputs are only passed through the sequential update
+        const bool registered
+            = m_hasRegistered && v3Global.libRegisteredOutputs().count(varp->name());
         m_modPortsp->add(varp->cloneTree(false));
-        m_comboPortsp->add(varp->cloneTree(false));
-        m_comboParamsp->add(pname + "_combo__V");
+        if (!registered) {
+            m_comboPortsp->add(varp->cloneTree(false));
+            m_comboParamsp->add(pname + "_combo__V");
+        }
         if (m_hasClk) {
             m_seqPortsp->add(varp->cloneTree(false));
             m_seqParamsp->add(pname + "_tmp__V");
         }
+        if (m_initSeqParamsp) m_initSeqParamsp->add(pname + (registered ? "_seq__V" : "_tmp__V"));
 
-        addLocalVariable(m_comboDeclsp, varp, "_combo__V");
+        if (!registered) addLocalVariable(m_comboDeclsp, varp, "_combo__V");
 
         if (m_hasClk) {
             addLocalVariable(m_seqDeclsp, varp, "_seq__V");
             addLocalVariable(m_tmpDeclsp, varp, "_tmp__V");
 
             m_nbAssignsp->add(pname + "_seq__V <= " + pname + "_tmp__V;\n");
-            m_seqAssignsp->add(pname + " = " + pname + "_seq__V;\n");
+            if (registered) {
+                m_regAssignsp->add(pname + " = " + pname + "_seq__V;\n");
+            } else {
+                m_seqAssignsp->add(pname + " = " + pname + "_seq__V;\n");
+            }
+        }
+        if (!registered) {
+            m_comboAssignsp->add(pname + " = " + pname + "_combo__V;\n");
+            m_cComboParamsp->add(varp->dpiArgType(true, false));
+            m_cComboOutsp->add(V3Task::assignInternalToDpi(varp, true, "", "", "handlep__V->")
+                               + "\n");
         }
-        m_comboAssignsp->add(pname + " = " + pname + "_combo__V;\n");
-        m_cComboParamsp->add(varp->dpiArgType(true, false));
-        m_cComboOutsp->add(V3Task::assignInternalToDpi(varp, true, "", "", "handlep__V->") + "\n");
         if (m_hasClk) {
             m_cSeqParamsp->add(varp->dpiArgType(true, false));
             m_cSeqOutsp->add(V3Task::assignInternalToDpi(varp, true, "", "", "handlep__V->")
@@ -523,3 +685,8 @@ void V3ProtectLib::protect() {
     UINFO(2, __FUNCTION__ << ":");
     ProtectVisitor{v3Global.rootp()};
 }
+
+void V3ProtectLib::findRegisteredOutputs(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    ProtectRegisteredOutputsVisitor{nodep};
+}
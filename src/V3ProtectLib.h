@@ -20,11 +20,15 @@
 #include "config_build.h"
 #include "verilatedos.h"
 
+class AstNetlist;
+
 //============================================================================
 
 class V3ProtectLib final {
 public:
     static void protect() VL_MT_DISABLED;
+    // Find outputs not combinationally dependent on data inputs, before scheduling
+    static void findRegisteredOutputs(AstNetlist* nodep) VL_MT_DISABLED;
 };
 
 #endif  // Guard
@@ -0,0 +1,162 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Only write changed SystemC output ports
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2003-2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3ScLazy's Transformations:
+//
+// Only with --sc --pins-sc-lazy. After descoping, for each SystemC output
+// port, create a shadow variable in Verilator's representation holding
+// the value last written to the port, and a flag set once the port has
+// been written. Both are cleared in _eval_static, and are never randomly
+// reset, as a port must be written the first time whatever its value.
+//      In fast code, replace each assignment to the port with:
+//          if (!__VscLazyInit__port | (__VscLazy__port != value)) {
+//              __VscLazyInit__port = 1;
+//              __VscLazy__port = value;
+//              port = __VscLazy__port;  // Converted and written to SystemC
+//          }
+//      In slow (initialization and settle) code, always write the port, so
+//      the SystemC signal matches the model even if it had a different
+//      initial value:
+//          __VscLazyInit__port = 1;
+//          __VscLazy__port = value;
+//          port = __VscLazy__port;
+//      Assignments of impure values in fast code are not changed.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3ScLazy.h"
+
+#include "V3Stats.h"
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class ScLazyVisitor final {
+    // NODE STATE
+    //  AstVar::user1p()    -> AstVar*: Shadow of SystemC output port
+    //  AstVar::user2p()    -> AstVar*: Flag set once SystemC output port was written
+    const VNUser1InUse m_user1InUse;
+    const VNUser2InUse m_user2InUse;
+
+    // STATE
+    AstNodeModule* const m_topModp;  // Top module, holding the ports
+    AstCFunc* m_staticFuncp = nullptr;  // Static initialization function
+    VDouble0 m_statLazy;  // Statistic tracking
+    VDouble0 m_statNotLazy;  // Statistic tracking
+
+    // METHODS
+    static bool isCandidate(const AstVar* varp) {
+        // Inouts may also be written by other SystemC processes
+        return varp->isSc() && varp->isPrimaryIO() && varp->direction() == VDirection::OUTPUT;
+    }
+
+    AstVar* newVar(FileLine* flp, const std::string& name, AstNodeDType* dtypep) {
+        AstVar* const varp = new AstVar{flp, VVarType::MODULETEMP, name, dtypep};
+        varp->isInternal(true);
+        varp->noReset(true);
+        m_topModp->addStmtsp(varp);
+        // Clear before anything else is evaluated
+        AstVarRef* const refp = new AstVarRef{flp, varp, VAccess::WRITE};
+        refp->selfPointer(VSelfPointerText{VSelfPointerText::This{}});
+        AstAssign* const clearp
+            = new AstAssign{flp, refp, new AstConst{flp, AstConst::DTyped{}, dtypep}};
+        if (AstNode* const firstp = m_staticFuncp->stmtsp()) {
+            firstp->addHereThisAsNext(clearp);
+        } else {
+            m_staticFuncp->addStmtsp(clearp);
+        }
+        return varp;
+    }
+    AstVar* shadowp(AstVar* varp) {
+        if (!varp->user1p()) {
+            FileLine* const flp = varp->fileline();
+            varp->user1p(newVar(flp, "__VscLazy__" + varp->name(), varp->dtypep()));
+            varp->user2p(newVar(flp, "__VscLazyInit__" + varp->name(),
+                                v3Global.rootp()->findBitDType()));
+        }
+        return VN_AS(varp->user1p(), Var);
+    }
+
+    void lazyAssign(AstAssign* assignp, bool slow) {
+        const AstVarRef* const lhsp = VN_CAST(assignp->lhsp(), VarRef);
+        if (!lhsp || !isCandidate(lhsp->varp())) return;
+        if (!slow && !assignp->rhsp()->isPure()) {
+            ++m_statNotLazy;
+            return;
+        }
+        UINFO(4, "SystemC lazy write " << assignp);
+        if (!slow) ++m_statLazy;
+        FileLine* const flp = assignp->fileline();
+        AstVar* const shadowVarp = shadowp(lhsp->varp());
+        AstVar* const initVarp = VN_AS(lhsp->varp()->user2p(), Var);
+        const auto newRef = [&](AstVar* varp, VAccess access) {
+            AstVarRef* const refp = new AstVarRef{flp, lhsp->classOrPackagep(), varp, access};
+            refp->selfPointer(lhsp->selfPointer());
+            return refp;
+        };
+        AstNodeExpr* const valuep = assignp->rhsp()->unlinkFrBack();
+        assignp->rhsp(newRef(shadowVarp, VAccess::READ));
+        AstNode* const setp
+            = new AstAssign{flp, newRef(initVarp, VAccess::WRITE),
+                            new AstConst{flp, AstConst::BitTrue{}}};
+        setp->addNext(new AstAssign{flp, newRef(shadowVarp, VAccess::WRITE), valuep});
+        if (slow) {
+            assignp->addHereThisAsNext(setp);
+            return;
+        }
+        AstNodeExpr* const condp
+            = new AstOr{flp, new AstNot{flp, newRef(initVarp, VAccess::READ)},
+                        new AstNeq{flp, newRef(shadowVarp, VAccess::READ),
+                                   valuep->cloneTreePure(false)}};
+        AstIf* const ifp = new AstIf{flp, condp};
+        assignp->replaceWith(ifp);
+        setp->addNext(assignp);
+        ifp->addThensp(setp);
+    }
+
+public:
+    // CONSTRUCTORS
+    explicit ScLazyVisitor(AstNetlist* netlistp)
+        : m_topModp{netlistp->topModulep()} {
+        for (AstNode* nodep = m_topModp->stmtsp(); nodep; nodep = nodep->nextp()) {
+            AstCFunc* const funcp = VN_CAST(nodep, CFunc);
+            if (funcp && funcp->name() == "_eval_static") m_staticFuncp = funcp;
+        }
+        UASSERT_OBJ(m_staticFuncp, m_topModp, "No _eval_static function");
+        std::vector<std::pair<AstAssign*, bool>> assignps;
+        netlistp->foreach([&](AstCFunc* funcp) {
+            const bool slow = funcp->slow();
+            funcp->foreach([&](AstAssign* assignp) { assignps.emplace_back(assignp, slow); });
+        });
+        for (const auto& pair : assignps) lazyAssign(pair.first, pair.second);
+    }
+    ~ScLazyVisitor() {
+        V3Stats::addStat("Optimizations, SystemC lazy output writes", m_statLazy);
+        V3Stats::addStat("Optimizations, SystemC lazy output writes not possible",
+                         m_statNotLazy);
+    }
+};
+
+//######################################################################
+// ScLazy class functions
+
+void V3ScLazy::scLazyAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { ScLazyVisitor{nodep}; }  // Destruct before checking
+    V3Global::dumpCheckGlobalTree("sclazy", 0, dumpTreeEitherLevel() >= 3);
+}
@@ -0,0 +1,154 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Allocate large unpacked arrays on demand
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2003-2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3Sparse's Transformations:
+//
+// For each module variable with a sparse metacomment, or at least
+// --sparse-threshold bytes in size:
+//      If the variable is a one dimensional unpacked array of integral
+//      elements, that is only referenced by selecting single elements or
+//      by $readmem/$writemem, mark it AstVar::attrSparse, so it is emitted
+//      as a VlSparseUnpacked, which allocates its storage on demand.
+//      Remove its constructor reset, as pages are zeroed when allocated.
+//      Otherwise, if requested by a metacomment, warn it can not be sparse.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3Sparse.h"
+
+#include "V3Stats.h"
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class SparseVisitor final {
+    // NODE STATE
+    //  AstVar::user1()     -> bool: Candidate for sparse storage
+    //  AstVar::user2p()    -> AstNode*: Reference that prevents sparse storage
+    const VNUser1InUse m_user1InUse;
+    const VNUser2InUse m_user2InUse;
+
+    // STATE
+    std::vector<AstVar*> m_candidates;  // Candidate variables, in netlist order
+    std::vector<AstNodeAssign*> m_resetps;  // Constructor resets of candidates
+    VDouble0 m_statSparse;  // Statistic tracking
+
+    // METHODS
+    // Returns reason variable can never be sparse, or empty if it might be
+    static std::string whyNotSparse(const AstVar* varp) {
+        const AstUnpackArrayDType* const adtypep
+            = VN_CAST(varp->dtypeSkipRefp(), UnpackArrayDType);
+        if (!adtypep || !adtypep->subDTypep()->skipRefp()->isIntegralOrPacked()) {
+            return "it is not a one dimensional unpacked array of integral elements";
+        }
+        if (varp->isIO()) return "it is a port";
+        if (varp->isSigPublic()) return "it is public";
+        if (varp->isForced()) return "it is forced";
+        if (varp->isWrittenByDpi() || varp->isDpiOpenArray()) return "it is accessed from DPI";
+        if (v3Global.opt.savable()) return "--savable is used";
+        return "";
+    }
+
+    bool isCandidate(AstVar* varp) {
+        const int threshold = v3Global.opt.sparseThreshold();
+        if (!varp->attrSparse() && (!threshold || !VN_IS(varp->dtypeSkipRefp(), UnpackArrayDType)
+                                    || varp->dtypeSkipRefp()->widthTotalBytes() < threshold)) {
+            return false;
+        }
+        const std::string why = whyNotSparse(varp);
+        if (why.empty()) return true;
+        if (varp->attrSparse()) {
+            varp->v3warn(SPARSEVAR, varp->prettyNameQ()
+                                        << " has sparse metacomment, but will not be sparse"
+                                           " because "
+                                        << why);
+            varp->attrSparse(false);
+        }
+        return false;
+    }
+
+    void findCandidates(AstNetlist* netlistp) {
+        const AstNodeModule* const constPoolModp = netlistp->constPoolp()->modp();
+        for (AstNode* nodep = netlistp->modulesp(); nodep; nodep = nodep->nextp()) {
+            const AstNodeModule* const modp = VN_AS(nodep, NodeModule);
+            if (modp == constPoolModp || VN_IS(modp, Class)) continue;
+            for (AstNode* stmtp = modp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+                AstVar* const varp = VN_CAST(stmtp, Var);
+                if (!varp || !isCandidate(varp)) continue;
+                varp->user1(true);
+                m_candidates.push_back(varp);
+            }
+        }
+    }
+
+    // Check reference is an element select, $readmem/$writemem, or constructor reset
+    void checkRef(AstVarRef* refp) {
+        AstNode* const backp = refp->backp();
+        if (const AstArraySel* const selp = VN_CAST(backp, ArraySel)) {
+            if (selp->fromp() == refp) return;
+        } else if (const AstNodeReadWriteMem* const memp = VN_CAST(backp, NodeReadWriteMem)) {
+            if (memp->memp() == refp) return;
+        } else if (AstNodeAssign* const assignp = VN_CAST(backp, NodeAssign)) {
+            const AstCReset* const resetp = VN_CAST(assignp->rhsp(), CReset);
+            if (assignp->lhsp() == refp && resetp && resetp->constructing()) {
+                m_resetps.push_back(assignp);
+                return;
+            }
+        }
+        refp->varp()->user2p(refp);
+    }
+
+public:
+    // CONSTRUCTORS
+    explicit SparseVisitor(AstNetlist* netlistp) {
+        findCandidates(netlistp);
+        if (m_candidates.empty()) return;
+        netlistp->foreach([this](AstVarRef* refp) {
+            if (refp->varp()->user1() && !refp->varp()->user2p()) checkRef(refp);
+        });
+        for (AstVar* const varp : m_candidates) {
+            if (const AstNode* const badp = varp->user2p()) {
+                if (varp->attrSparse()) {
+                    badp->v3warn(SPARSEVAR, varp->prettyNameQ()
+                                                << " has sparse metacomment, but will not be"
+                                                   " sparse because it is referenced other than"
+                                                   " by selecting an element");
+                    varp->attrSparse(false);
+                }
+                continue;
+            }
+            UINFO(4, "Sparse " << varp);
+            varp->attrSparse(true);
+            ++m_statSparse;
+        }
+        for (AstNodeAssign* const assignp : m_resetps) {
+            if (!VN_AS(assignp->lhsp(), VarRef)->varp()->attrSparse()) continue;
+            VL_DO_DANGLING(assignp->unlinkFrBack()->deleteTree(), assignp);
+        }
+    }
+    ~SparseVisitor() { V3Stats::addStat("Optimizations, Sparse arrays", m_statSparse); }
+};
+
+//######################################################################
+// Sparse class functions
+
+void V3Sparse::sparseAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { SparseVisitor{nodep}; }  // Destruct before checking
+    V3Global::dumpCheckGlobalTree("sparse", 0, dumpTreeEitherLevel() >= 3);
+}
@@ -100,6 +100,22 @@ public:
     virtual ~V3Statistic() = default;
 };
 
+//============================================================================
+// Scoped timer adding a span to the --stats-timeline output
+
+class V3StatsTimer final {
+    // MEMBERS
+    const std::string m_name;  // Name of span, empty if not recording
+    const uint64_t m_startUsecs;  // Start time
+
+public:
+    // CONSTRUCTORS
+    explicit V3StatsTimer(const std::string& name) VL_MT_SAFE;
+    ~V3StatsTimer() VL_MT_SAFE;
+    VL_UNCOPYABLE(V3StatsTimer);
+    VL_UNMOVABLE(V3StatsTimer);
+};
+
 //============================================================================
 
 class V3Stats final {
@@ -152,6 +168,8 @@ public:
     static void statsFinalAll(AstNetlist* nodep);
     /// Called by the top level to dump the statistics
     static void statsReport();
+    /// Called by the top level to dump the --stats-timeline
+    static void timelineReport();
     /// Called by debug dumps
     static void infoHeader(std::ofstream& os, const string& prefix);
     /// Called for final build report
@@ -22,7 +22,14 @@
 #include "V3Stats.h"
 
 #include <iomanip>
+#include <map>
+#include <memory>
+#include <thread>
+#include <typeindex>
 #include <unordered_map>
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -187,6 +194,208 @@ public:
 
 StatsReport::StatColl StatsReport::s_allStats;
 
+//######################################################################
+// Timeline of Verilator's own execution, for --stats-timeline
+
+class StatsTimeline final {
+    // TYPES
+    struct Span final {
+        std::string m_name;  // Name of span
+        bool m_stage;  // Whole stage, as opposed to a V3StatsTimer
+        uint64_t m_startUsecs;  // Start time
+        uint64_t m_durationUsecs;  // Duration
+        size_t m_threadNum;  // Thread the span was recorded on
+        uint64_t m_memCurrent;  // Memory in use at end of stage (bytes), zero for timers
+        uint64_t m_memPeak;  // Peak memory at end of stage (bytes), zero for timers
+    };
+    struct Summary final {
+        uint64_t m_count = 0;  // Number of spans
+        uint64_t m_totalUsecs = 0;  // Sum of durations
+        uint64_t m_maxUsecs = 0;  // Longest duration
+    };
+
+    // STATE
+    V3Mutex m_mutex;  // Protects members, timers may be used by multiple threads
+    const uint64_t m_startUsecs = V3Os::timeUsecs();  // Time all spans are relative to
+    std::vector<Span> m_spans VL_GUARDED_BY(m_mutex);  // All spans in recording order
+    std::map<std::thread::id, size_t> m_threadNums VL_GUARDED_BY(m_mutex);  // Thread numbers
+    bool m_hadStage VL_GUARDED_BY(m_mutex) = false;  // Stage recorded already
+
+    // METHODS
+    size_t threadNum() VL_REQUIRES(m_mutex) {
+        const auto pair = m_threadNums.emplace(std::this_thread::get_id(), m_threadNums.size());
+        return pair.first->second;
+    }
+
+public:
+    static StatsTimeline& s() VL_MT_SAFE {
+        static StatsTimeline s_timeline;
+        return s_timeline;
+    }
+
+    uint64_t nowUsecs() const VL_MT_SAFE { return V3Os::timeUsecs(); }
+    void addStage(const std::string& name, uint64_t startUsecs, uint64_t endUsecs,
+                  uint64_t memCurrent, uint64_t memPeak) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const V3LockGuard lock{m_mutex};
+        // First stage covers everything since start, e.g.: parsing
+        if (!m_hadStage) startUsecs = std::min(startUsecs, m_startUsecs);
+        m_hadStage = true;
+        m_spans.push_back({name, true, startUsecs, endUsecs - startUsecs, threadNum(),
+                           memCurrent, memPeak});
+    }
+    void addTimer(const std::string& name, uint64_t startUsecs, uint64_t endUsecs)
+        VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const V3LockGuard lock{m_mutex};
+        m_spans.push_back({name, false, startUsecs, endUsecs - startUsecs, threadNum(), 0, 0});
+    }
+
+    void report() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const V3LockGuard lock{m_mutex};
+        // Trace Event Format JSON, viewable with e.g. Perfetto or speedscope
+        const string filename = v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix()
+                                + "__stats_timeline.json";
+        V3OutJsonFile of{filename};
+        of.put("displayTimeUnit", "ms");
+        of.begin("traceEvents", '[');
+        std::map<std::string, Summary> summaries;
+        for (const Span& span : m_spans) {
+            const uint64_t start = span.m_startUsecs - std::min(span.m_startUsecs, m_startUsecs);
+            of.begin()
+                .put("name", span.m_name)
+                .put("cat", span.m_stage ? "stage" : "timer")
+                .put("ph", "X")
+                .put("ts", start)
+                .put("dur", span.m_durationUsecs)
+                .put("pid", 0)
+                .put("tid", static_cast<int>(span.m_threadNum))
+                .end();
+            if (span.m_stage) {
+                // Memory as a counter track, sampled at the end of each stage
+                of.begin()
+                    .put("name", "Memory (MB)")
+                    .put("ph", "C")
+                    .put("ts", start + span.m_durationUsecs)
+                    .put("pid", 0)
+                    .begin("args")
+                    .put("current", static_cast<int>(span.m_memCurrent / 1024 / 1024))
+                    .put("peak", static_cast<int>(span.m_memPeak / 1024 / 1024))
+                    .end()
+                    .end();
+            } else {
+                Summary& summary = summaries[span.m_name];
+                ++summary.m_count;
+                summary.m_totalUsecs += span.m_durationUsecs;
+                summary.m_maxUsecs = std::max(summary.m_maxUsecs, span.m_durationUsecs);
+            }
+        }
+        of.end();
+        // Histogram of timers into the --stats report
+        for (const auto& pair : summaries) {
+            const Summary& summary = pair.second;
+            V3Stats::addStat(V3Statistic{"*", "Timer, Calls, " + pair.first,
+                                         static_cast<double>(summary.m_count), 0, true, true});
+            V3Stats::addStatPerf("Timer, Total time (sec), " + pair.first,
+                                 summary.m_totalUsecs / 1.0e6);
+            V3Stats::addStatPerf("Timer, Max time (sec), " + pair.first,
+                                 summary.m_maxUsecs / 1.0e6);
+        }
+    }
+};
+
+V3StatsTimer::V3StatsTimer(const std::string& name)
+    : m_name{v3Global.opt.statsTimeline() ? name : ""}
+    , m_startUsecs{m_name.empty() ? 0 : StatsTimeline::s().nowUsecs()} {}
+
+V3StatsTimer::~V3StatsTimer() {
+    if (m_name.empty()) return;
+    StatsTimeline::s().addTimer(m_name, m_startUsecs, V3Os::timeUsecs());
+}
+
+//######################################################################
+// Counts of visit() dispatches by visitor and node type, for --stats-timeline
+
+class StatsVisits final {
+    // TYPES
+    using Counts = std::array<uint64_t, VNType::NUM_TYPES()>;  // Indexed by VNType
+    using VisitorCounts = std::unordered_map<std::type_index, Counts>;
+    struct ThreadState final {
+        VisitorCounts m_counts;  // Counts of this thread
+        // Counts of the last visitor type seen, as consecutive visits are mostly the same
+        const std::type_info* m_lastTypep = nullptr;
+        Counts* m_lastCountsp = nullptr;
+    };
+
+    // STATE
+    V3Mutex m_mutex;  // Protects m_threads
+    // State of each thread that counted. Only written by its own thread, and
+    // only read by report() after all other threads are done.
+    std::vector<std::unique_ptr<ThreadState>> m_threads VL_GUARDED_BY(m_mutex);
+
+    // METHODS
+    ThreadState* newThreadState() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const V3LockGuard lock{m_mutex};
+        m_threads.emplace_back(new ThreadState);
+        return m_threads.back().get();
+    }
+    static string demangle(const char* namep) {
+#if defined(__GNUC__)
+        int status = 0;
+        char* const demangledp = abi::__cxa_demangle(namep, nullptr, nullptr, &status);
+        if (demangledp) {
+            const string result{demangledp};
+            std::free(demangledp);
+            return result;
+        }
+#endif
+        return namep;
+    }
+
+public:
+    static StatsVisits& s() VL_MT_SAFE {
+        static StatsVisits s_visits;
+        return s_visits;
+    }
+
+    void add(const std::type_info& visitorType, VNType type) VL_MT_SAFE {
+        static thread_local ThreadState* t_statep = nullptr;
+        if (VL_UNLIKELY(!t_statep)) t_statep = newThreadState();
+        ThreadState& state = *t_statep;
+        if (VL_UNLIKELY(state.m_lastTypep != &visitorType)) {
+            state.m_lastTypep = &visitorType;
+            state.m_lastCountsp = &state.m_counts.emplace(visitorType, Counts{}).first->second;
+        }
+        ++(*state.m_lastCountsp)[type];
+    }
+
+    void report() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const V3LockGuard lock{m_mutex};
+        // Sum over threads
+        VisitorCounts sums;
+        for (const std::unique_ptr<ThreadState>& statep : m_threads) {
+            for (const auto& pair : statep->m_counts) {
+                Counts& sum = sums.emplace(pair.first, Counts{}).first->second;
+                for (size_t i = 0; i < sum.size(); ++i) sum[i] += pair.second[i];
+            }
+        }
+        // Histogram of node types per visitor into the --stats report
+        for (const auto& pair : sums) {
+            const string prefix = "Visits, " + demangle(pair.first.name()) + ", ";
+            uint64_t total = 0;
+            for (size_t i = 0; i < pair.second.size(); ++i) {
+                if (!pair.second[i]) continue;
+                total += pair.second[i];
+                const VNType type{static_cast<VNType::en>(i)};
+                V3Stats::addStat(prefix + type.ascii(), pair.second[i]);
+            }
+            V3Stats::addStat(prefix + "TOTAL", total);
+        }
+    }
+};
+
+void VNVisitorConst::countVisit(const AstNode* nodep) {
+    StatsVisits::s().add(typeid(*this), nodep->type());
+}
+
 //######################################################################
 // V3Statstic class
 
@@ -203,14 +412,15 @@ void V3Stats::addStat(const V3Statistic& stat) { StatsReport::addStat(stat); }
 double V3Stats::getStatSum(const string& name) { return StatsReport::getStatSum(name); }
 
 void V3Stats::statsStage(const string& name) {
-    static double s_lastWallTime = -1;
+    static uint64_t s_lastWallTime = 0;
     static int s_fileNumber = 0;
 
     const string digitName = V3Global::digitsFilename(++s_fileNumber) + "_" + name;
 
-    const double wallTime = V3Os::timeUsecs() / 1.0e6;
-    if (s_lastWallTime < 0) s_lastWallTime = wallTime;
-    const double wallTimeDelta = wallTime - s_lastWallTime;
+    const uint64_t wallTime = V3Os::timeUsecs();
+    if (!s_lastWallTime) s_lastWallTime = wallTime;
+    const uint64_t startWallTime = s_lastWallTime;
+    const double wallTimeDelta = (wallTime - s_lastWallTime) / 1.0e6;
     s_lastWallTime = wallTime;
     V3Stats::addStatPerf("Stage, Elapsed time (sec), " + digitName, wallTimeDelta);
     V3Stats::addStatPerf("Stage, Elapsed time (sec), TOTAL", wallTimeDelta);
@@ -219,6 +429,10 @@ void V3Stats::statsStage(const string& name) {
     VlOs::memUsageBytes(memPeak /*ref*/, memCurrent /*ref*/);
     V3Stats::addStatPerf("Stage, Memory current (MB), " + digitName, memCurrent / 1024.0 / 1024.0);
     V3Stats::addStatPerf("Stage, Memory peak (MB), " + digitName, memPeak / 1024.0 / 1024.0);
+
+    if (v3Global.opt.statsTimeline()) {
+        StatsTimeline::s().addStage(name, startWallTime, wallTime, memCurrent, memPeak);
+    }
 }
 
 void V3Stats::infoHeader(std::ofstream& os, const string& prefix) {
@@ -245,6 +459,12 @@ void V3Stats::statsReport() {
     VL_DO_DANGLING(delete ofp, ofp);
 }
 
+void V3Stats::timelineReport() {
+    UINFO(2, __FUNCTION__ << ":");
+    StatsTimeline::s().report();
+    StatsVisits::s().report();
+}
+
 void V3Stats::summaryReport() {
     StatsReport::calculate();
     std::cout << "- V e r i l a t i o n   R e p o r t: " << V3Options::version() << "\n";
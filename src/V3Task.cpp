@@ -754,7 +754,10 @@ class TaskVisitor final : public VNVisitor {
         string dpiproto;
         if (nodep->dpiPure()) dpiproto += "pure ";
         if (nodep->dpiContext()) dpiproto += "context ";
-        dpiproto += rtnvarp ? rtnvarp->dpiArgType(true, true) : "void";
+        if (nodep->dpiNative()) dpiproto += "/* dpi_native */ ";
+        dpiproto += !rtnvarp             ? "void"
+                    : nodep->dpiNative() ? rtnvarp->dpiNativeArgType(true, true)
+                                         : rtnvarp->dpiArgType(true, true);
         dpiproto += " " + nodep->cname() + " (";
         string args;
         for (AstNode* stmtp = nodep->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
@@ -766,7 +769,9 @@ class TaskVisitor final : public VNVisitor {
                     }
                     // Include both the Verilator and C type names, as if either
                     // differ we may get C compilation problems later
-                    const std::string dpiType = portp->dpiArgType(false, false);
+                    const std::string dpiType = nodep->dpiNative()
+                                                    ? portp->dpiNativeArgType(false, false)
+                                                    : portp->dpiArgType(false, false);
                     dpiproto += dpiType;
                     const std::string vType = portp->dtypep()->prettyDTypeName(false);
                     if (!portp->isDpiOpenArray() && dpiType != vType) {
@@ -866,6 +871,29 @@ class TaskVisitor final : public VNVisitor {
         return stmtsp;
     }
 
+    static AstNodeStmt* createNativeMask(AstVarScope* vscp) {
+        // Clear bits above the variable's width, which a dpi_native callee may have set
+        const AstVar* const varp = vscp->varp();
+        const int width = varp->width();
+        FileLine* const flp = vscp->fileline();
+        std::string mask;
+        if (varp->isWide()) {
+            if (width % VL_EDATASIZE == 0) return nullptr;
+            mask = "[" + std::to_string(varp->widthWords() - 1) + "] &= VL_MASK_E("
+                   + std::to_string(width) + ");";
+        } else if (varp->isQuad()) {
+            if (width == VL_QUADSIZE) return nullptr;
+            mask = " &= VL_MASK_Q(" + std::to_string(width) + ");";
+        } else {
+            if (width == 8 || width == 16 || width == VL_IDATASIZE) return nullptr;
+            mask = " &= VL_MASK_I(" + std::to_string(width) + ");";
+        }
+        AstCStmt* const cstmtp = new AstCStmt{flp};
+        cstmtp->add(new AstVarRef{flp, vscp, VAccess::READWRITE});
+        cstmtp->add(mask);
+        return cstmtp;
+    }
+
     // Create dispatch wrapper
     AstCFunc* makeDpiExportDispatcher(AstNodeFTask* const nodep, AstVar* const rtnvarp) {
         // Verilog name has __ conversion and other tricks, to match DPI C code, back that out
@@ -981,12 +1009,13 @@ class TaskVisitor final : public VNVisitor {
         const string name = AstNode::prettyName(nodep->cname());
         checkLegalCIdentifier(nodep, name);
         // Tasks (but not void functions) return a boolean 'int' indicating disabled
-        const string rtnType = rtnvarp            ? rtnvarp->dpiArgType(true, true)
-                               : nodep->dpiTask() ? "int"
-                                                  : "";
+        const string rtnType = !rtnvarp            ? (nodep->dpiTask() ? "int" : "")
+                               : nodep->dpiNative() ? rtnvarp->dpiNativeArgType(true, true)
+                                                    : rtnvarp->dpiArgType(true, true);
         AstCFunc* const funcp = new AstCFunc{nodep->fileline(), name, m_scopep, rtnType};
         funcp->dpiContext(nodep->dpiContext());
         funcp->dpiImportPrototype(true);
+        funcp->dpiNative(nodep->dpiNative());
         funcp->dontCombine(true);
         funcp->entryPoint(false);
         funcp->isMethod(false);
@@ -1090,7 +1119,15 @@ class TaskVisitor final : public VNVisitor {
 
                     if (args != "") args += ", ";
 
-                    if (portp->isDpiOpenArray()) {
+                    if (nodep->dpiNative() && portp->isDpiNativeArg()) {
+                        // Pass internal representation, without a temporary
+                        if (portp->isWide()) {
+                            args += portp->name() + ".data()";
+                        } else {
+                            if (portp->isWritable()) args += "&";
+                            args += portp->name();
+                        }
+                    } else if (portp->isDpiOpenArray()) {
                         AstNodeDType* const dtypep = portp->dtypep()->skipRefp();
                         UASSERT_OBJ(!VN_IS(dtypep, DynArrayDType) && !VN_IS(dtypep, QueueDType),
                                     portp,
@@ -1140,7 +1177,15 @@ class TaskVisitor final : public VNVisitor {
             AstCCall* const callp = new AstCCall{nodep->fileline(), dpiFuncp};
             callp->dtypeSetVoid();
             callp->argTypes(args);
-            if (rtnvscp) {
+            if (rtnvscp && nodep->dpiNative() && rtnvscp->varp()->isDpiNativeArg()) {
+                // Return value is already in internal representation
+                AstCStmt* const cstmtp = new AstCStmt{nodep->fileline()};
+                cstmtp->add(new AstVarRef{nodep->fileline(), rtnvscp, VAccess::WRITE});
+                cstmtp->add(" = ");
+                cstmtp->add(callp);
+                cstmtp->add(";");
+                cfuncp->addStmtsp(cstmtp);
+            } else if (rtnvscp) {
                 // If it has a return value, capture it
                 cfuncp->addStmtsp(createDpiTemp(rtnvscp->varp(), tmpSuffixp));
                 const std::string sel = rtnvscp->varp()->basicp()->isDpiPrimitive() ? "" : "[0]";
@@ -1164,8 +1209,15 @@ class TaskVisitor final : public VNVisitor {
                     && !portp->isDpiOpenArray()) {
                     AstVarScope* const portvscp = VN_AS(
                         portp->user2p(), VarScope);  // Remembered when we created it earlier
-                    cfuncp->addStmtsp(
-                        createAssignDpiToInternal(portvscp, portp->name() + tmpSuffixp));
+                    if (nodep->dpiNative() && portp->isDpiNativeArg()) {
+                        // Only need to clear any bits above the width set by the callee
+                        if (AstNodeStmt* const maskp = createNativeMask(portvscp)) {
+                            cfuncp->addStmtsp(maskp);
+                        }
+                    } else {
+                        cfuncp->addStmtsp(
+                            createAssignDpiToInternal(portvscp, portp->name() + tmpSuffixp));
+                    }
                 }
             }
         }
@@ -1202,7 +1254,14 @@ class TaskVisitor final : public VNVisitor {
             AstVar* const portp = VN_AS(nodep->fvarp(), Var);
             UASSERT_OBJ(portp, nodep, "function without function output variable");
             UASSERT_OBJ(portp->isFuncReturn(), nodep, "Not marked as function return var");
-            if (nodep->dpiImport() || nodep->dpiExport()) {
+            if (nodep->dpiImport() && nodep->dpiNative() && portp->isDpiNativeArg()) {
+                if (portp->isWide()) {
+                    portp->v3error("dpi_native DPI function may not return a > 64 bits wide "
+                                   "type.\n"
+                                   + portp->warnMore()
+                                   + "... Suggest make it an output argument instead?");
+                }
+            } else if (nodep->dpiImport() || nodep->dpiExport()) {
                 AstBasicDType* const bdtypep = portp->dtypep()->basicp();
                 if (!bdtypep->isDpiPrimitive()) {
                     if (bdtypep->isDpiBitVec() && portp->width() > 32) {
@@ -1292,6 +1351,7 @@ class TaskVisitor final : public VNVisitor {
         }
         cfuncp->isVirtual(nodep->isVirtual());
         cfuncp->dpiPure(nodep->dpiPure());
+        cfuncp->dpiThreadSafe(nodep->dpiThreadSafe());
         if (nodep->name() == "new") cfuncp->isConstructor(true);
         if (cfuncp->dpiExportImpl()) cfuncp->cname(nodep->cname());
 
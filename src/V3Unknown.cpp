@@ -466,7 +466,10 @@ class UnknownVisitor final : public VNVisitor {
                         VL_DO_DANGLING(nodep->deleteTree(), nodep);
                         return xexprp;
                     }
-                    return new AstCond{nodep->fileline(), condp, nodep, xexprp};
+                    AstCond* const condNewp
+                        = new AstCond{nodep->fileline(), condp, nodep, xexprp};
+                    condNewp->guard(true);
+                    return condNewp;
                 }();
                 UINFOTREE(9, newp, "", "_new");
                 // Link in conditional
@@ -548,8 +551,9 @@ class UnknownVisitor final : public VNVisitor {
                 } else {
                     xnum.setAllBitsX();
                 }
-                AstNode* const newp = new AstCond{nodep->fileline(), condp, nodep,
+                AstCond* const newp = new AstCond{nodep->fileline(), condp, nodep,
                                                   new AstConst{nodep->fileline(), xnum}};
+                newp->guard(true);
                 UINFOTREE(9, newp, "", "_new");
                 // Link in conditional, can blow away temp xor
                 replaceHandle.relink(newp);
@@ -559,10 +563,11 @@ class UnknownVisitor final : public VNVisitor {
                 // ARRAYSEL(...) -> ARRAYSEL(COND(LT(bit<maxbit), bit, 0))
                 VNRelinker replaceHandle;
                 AstNodeExpr* const asBitp = nodep->bitp()->unlinkFrBack(&replaceHandle);
-                AstNodeExpr* const newp
+                AstCond* const newp
                     = new AstCond{asBitp->fileline(), condp, asBitp,
                                   new AstConst{asBitp->fileline(), AstConst::WidthedValue{},
                                                asBitp->width(), 0}};
+                newp->guard(true);
                 // Added X's, tristate them too
                 UINFOTREE(9, newp, "", "_new");
                 replaceHandle.relink(newp);
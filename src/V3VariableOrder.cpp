@@ -36,6 +36,8 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 
 using MTaskIdVec = std::vector<bool>;  // Used as a bit-set indexed by MTask ID
 using MTaskAffinityMap = std::unordered_map<const AstVar*, MTaskIdVec>;
+using HotVarSet = std::unordered_set<const AstVar*>;
+using ThreadWriterMap = std::unordered_map<const AstVar*, uint32_t>;  // Var -> writing thread
 
 // Trace through code reachable form an MTask and annotate referenced variabels
 class GatherMTaskAffinity final : VNVisitorConst {
@@ -90,6 +92,110 @@ public:
     }
 };
 
+// Trace through code reachable from '_eval' and record the referenced variables. These are
+// the variables accessed on every evaluation, all others are only used during initialization,
+// by DPI/public accessors, tracing, etc., so are cold.
+class GatherHotVars final : VNVisitorConst {
+    // NODE STATE
+    //  AstCFunc::user1()  // bool: Already traced this function
+    const VNUser1InUse m_user1InUse;
+
+    // STATE
+    HotVarSet& m_results;  // The result set being built
+
+    // CONSTRUCTOR
+    GatherHotVars(AstCFunc* evalp, HotVarSet& results)
+        : m_results{results} {
+        iterateConst(evalp);
+    }
+    ~GatherHotVars() = default;
+    VL_UNMOVABLE(GatherHotVars);
+
+    // VISIT
+    void visit(AstNodeVarRef* nodep) override { m_results.emplace(nodep->varp()); }
+
+    void visit(AstCFunc* nodep) override {
+        if (nodep->user1SetOnce()) return;  // Prevent repeat traversals/recursion
+        iterateChildrenConst(nodep);
+    }
+
+    void visit(AstNodeCCall* nodep) override {
+        iterateChildrenConst(nodep);  // Arguments
+        iterateConst(nodep->funcp());  // Callee
+    }
+
+    void visit(AstAddrOfCFunc* nodep) override {
+        iterateConst(nodep->funcp());  // E.g.: thread functions of an AstExecGraph
+    }
+
+    void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
+
+public:
+    static void apply(AstCFunc* evalp, HotVarSet& results) { GatherHotVars{evalp, results}; }
+};
+
+// Trace through the code run by each thread of each AstExecGraph, and record which thread
+// writes each variable.
+class GatherThreadWriters final : VNVisitorConst {
+public:
+    static constexpr uint32_t MULTIPLE = std::numeric_limits<uint32_t>::max();
+
+private:
+    // NODE STATE
+    //  AstCFunc::user1()  // bool: Already traced this function from this thread
+    const VNUser1InUse m_user1InUse;
+
+    // STATE
+    ThreadWriterMap& m_results;  // The result map being built
+    const uint32_t m_threadId;  // Thread being analysed
+
+    // CONSTRUCTOR
+    GatherThreadWriters(AstCFunc* funcp, uint32_t threadId, ThreadWriterMap& results)
+        : m_results{results}
+        , m_threadId{threadId} {
+        iterateConst(funcp);
+    }
+    ~GatherThreadWriters() = default;
+    VL_UNMOVABLE(GatherThreadWriters);
+
+    // VISIT
+    void visit(AstNodeVarRef* nodep) override {
+        if (!nodep->access().isWriteOrRW()) return;
+        const auto pair = m_results.emplace(nodep->varp(), m_threadId);
+        if (pair.first->second != m_threadId) pair.first->second = MULTIPLE;
+    }
+
+    void visit(AstCFunc* nodep) override {
+        if (nodep->user1SetOnce()) return;  // Prevent repeat traversals/recursion
+        iterateChildrenConst(nodep);
+    }
+
+    void visit(AstNodeCCall* nodep) override {
+        iterateChildrenConst(nodep);  // Arguments
+        iterateConst(nodep->funcp());  // Callee
+    }
+
+    void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
+
+public:
+    static void apply(const AstExecGraph* execGraphp, ThreadWriterMap& results) {
+        // The thread functions are started on workers 0, 1, ... in order, and the last one is
+        // called directly, on the main thread, which is numbered after all workers.
+        uint32_t workerId = 0;
+        for (AstNode* stmtp = execGraphp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            stmtp->foreach([&](AstAddrOfCFunc* addrp) {
+                GatherThreadWriters{addrp->funcp(), workerId++, results};
+            });
+            if (const AstStmtExpr* const exprp = VN_CAST(stmtp, StmtExpr)) {
+                if (const AstCCall* const callp = VN_CAST(exprp->exprp(), CCall)) {
+                    const uint32_t mainId = v3Global.opt.threads() - 1;
+                    GatherThreadWriters{callp->funcp(), mainId, results};
+                }
+            }
+        }
+    }
+};
+
 //######################################################################
 // Establish mtask variable sort order in mtasks mode
 
@@ -128,16 +234,22 @@ uint32_t VarTspSorter::s_serialNext = 0;
 struct VarAttributes final {
     uint8_t stratum;  // Roughly equivalent to alignment requirement, to avoid padding
     bool anonOk;  // Can be emitted as part of anonymous structure
+    bool cold;  // Not accessed during evaluation
 };
 class VariableOrder final {
     std::unordered_map<const AstVar*, VarAttributes> m_attributes;
 
     const MTaskAffinityMap& m_mTaskAffinity;
+    const HotVarSet& m_hotVars;
+    const ThreadWriterMap& m_threadWriters;
     std::vector<AstVar*>& m_varps;
 
     VariableOrder(AstNodeModule* modp, const MTaskAffinityMap& mTaskAffinity,
+                  const HotVarSet& hotVars, const ThreadWriterMap& threadWriters,
                   std::vector<AstVar*>& varps)
         : m_mTaskAffinity{mTaskAffinity}
+        , m_hotVars{hotVars}
+        , m_threadWriters{threadWriters}
         , m_varps{varps} {
         orderModuleVars(modp);
     }
@@ -158,6 +270,9 @@ class VariableOrder final {
                                 "m_attributes should be populated for each AstVar");
                         const auto& attrA = m_attributes.at(ap);
                         const auto& attrB = m_attributes.at(bp);
+                        if (attrA.cold != attrB.cold) {  // Hot before cold
+                            return attrB.cold;
+                        }
                         if (attrA.anonOk != attrB.anonOk) {  // Anons before non-anons
                             return attrA.anonOk;
                         }
@@ -207,8 +322,82 @@ class VariableOrder final {
         sortAndAppend(m2v[emptyVec]);
     }
 
+    // Thread writing the variable, or MULTIPLE if written by many or none
+    uint32_t writerThread(const AstVar* varp) const {
+        const auto it = m_threadWriters.find(varp);
+        return it == m_threadWriters.end() ? GatherThreadWriters::MULTIPLE : it->second;
+    }
+
+    // Estimate the number of cache lines in the model written by more than one thread
+    size_t sharedCacheLines(const std::vector<AstVar*>& varps, bool aligned) const {
+        constexpr size_t lineBytes = 64;  // VL_CACHE_LINE_BYTES
+        std::unordered_map<size_t, uint32_t> lineWriters;  // Cache line -> writing thread
+        size_t offset = 0;
+        for (const AstVar* const varp : varps) {
+            if (varp->isStatic()) continue;
+            const AstNodeDType* const dtypep = varp->dtypeSkipRefp();
+            size_t align = std::max(dtypep->widthAlignBytes(), 1);
+            if (aligned && varp->alignCacheLine()) align = lineBytes;
+            const size_t size = std::max(dtypep->widthTotalBytes(), 1);
+            offset = (offset + align - 1) / align * align;
+            const auto it = m_threadWriters.find(varp);
+            if (it != m_threadWriters.end()) {
+                for (size_t line = offset / lineBytes; line <= (offset + size - 1) / lineBytes;
+                     ++line) {
+                    const auto pair = lineWriters.emplace(line, it->second);
+                    if (pair.first->second != it->second) {
+                        pair.first->second = GatherThreadWriters::MULTIPLE;
+                    }
+                }
+            }
+            offset += size;
+        }
+        return std::count_if(lineWriters.begin(), lineWriters.end(), [](const auto& pair) {
+            return pair.second == GatherThreadWriters::MULTIPLE;
+        });
+    }
+
+    // Group variables written by a single thread, and start each group on a new cache line,
+    // so threads do not write the same cache lines
+    void segregateThreadWrites(std::vector<AstVar*>& varps) {
+        const size_t sharedBefore = sharedCacheLines(varps, false);
+        if (!sharedBefore) return;
+        const auto groupOf = [this](const AstVar* varp) {
+            if (varp->isStatic() || m_attributes.at(varp).cold) {
+                return GatherThreadWriters::MULTIPLE;
+            }
+            return writerThread(varp);
+        };
+        stable_sort(varps.begin(), varps.end(), [&](const AstVar* ap, const AstVar* bp) {
+            if (ap->isStatic() != bp->isStatic()) return bp->isStatic();
+            const bool coldA = m_attributes.at(ap).cold;
+            const bool coldB = m_attributes.at(bp).cold;
+            if (coldA != coldB) return coldB;
+            return groupOf(ap) < groupOf(bp);
+        });
+        // Align start of each thread's group, and the first variable after them
+        uint32_t lastGroup = GatherThreadWriters::MULTIPLE;
+        bool owned = false;
+        for (AstVar* const varp : varps) {
+            const uint32_t group = groupOf(varp);
+            if (group != lastGroup && (group != GatherThreadWriters::MULTIPLE || owned)) {
+                varp->alignCacheLine(true);
+                owned = group != GatherThreadWriters::MULTIPLE;
+                if (!owned) break;
+            }
+            lastGroup = group;
+        }
+        V3Stats::addStatSum("Variable order, cross-thread written cache lines, before",
+                            sharedBefore);
+        V3Stats::addStatSum("Variable order, cross-thread written cache lines, after",
+                            sharedCacheLines(varps, true));
+    }
+
     // cppcheck-suppress constParameterPointer
     void orderModuleVars(AstNodeModule* modp) {
+        // Class members are accessed through objects, not classified as hot or cold
+        const bool isClass = VN_IS(modp, Class);
+        size_t nCold = 0;
         // Unlink all module variables from the module, compute attributes
         for (AstNode *nodep = modp->stmtsp(), *nextp; nodep; nodep = nextp) {
             nextp = nodep->nextp();
@@ -228,23 +417,30 @@ class VariableOrder final {
                                         : (sigbytes == 2)                                   ? 3
                                         : (sigbytes == 1)                                   ? 2
                                                                                             : 10;
-                m_attributes.emplace(varp, VarAttributes{stratum, EmitCUtil::isAnonOk(varp)});
+                // Cold
+                const bool cold = !isClass && !m_hotVars.empty() && !m_hotVars.count(varp);
+                if (cold) ++nCold;
+                m_attributes.emplace(varp,
+                                     VarAttributes{stratum, EmitCUtil::isAnonOk(varp), cold});
             }
         }
+        if (nCold) V3Stats::addStatSum("Variable order, cold variables", nCold);
 
         if (!m_varps.empty()) {
             if (!v3Global.opt.mtasks()) {
                 simpleSortVars(m_varps);
             } else {
                 tspSortVars(m_varps);
+                if (!m_threadWriters.empty()) segregateThreadWrites(m_varps);
             }
         }
     }
 
 public:
     static void processModule(AstNodeModule* modp, const MTaskAffinityMap& mTaskAffinity,
+                              const HotVarSet& hotVars, const ThreadWriterMap& threadWriters,
                               std::vector<AstVar*>& varps) VL_MT_STABLE {
-        VariableOrder{modp, mTaskAffinity, varps};
+        VariableOrder{modp, mTaskAffinity, hotVars, threadWriters, varps};
     }
 };
 
@@ -255,15 +451,21 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
     UINFO(2, __FUNCTION__ << ":");
 
     MTaskAffinityMap mTaskAffinity;
+    ThreadWriterMap threadWriters;
 
-    // Gather MTask affinities
+    // Gather MTask affinities, and which thread writes each variable
     if (v3Global.opt.mtasks()) {
         netlistp->topModulep()->foreach([&](AstExecGraph* execGraphp) {
             for (const V3GraphVertex& vtx : execGraphp->depGraphp()->vertices()) {
                 GatherMTaskAffinity::apply(vtx.as<const ExecMTask>(), mTaskAffinity);
             }
+            GatherThreadWriters::apply(execGraphp, threadWriters);
         });
     }
+
+    // Gather variables used during evaluation, the rest are moved to the end
+    HotVarSet hotVars;
+    if (AstCFunc* const evalp = netlistp->evalp()) GatherHotVars::apply(evalp, hotVars);
     if (v3Global.opt.stats()) V3Stats::statsStage("variableorder-gather");
 
     // Sort variables for each module
@@ -274,8 +476,9 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
         for (AstNodeModule* modp = v3Global.rootp()->modulesp(); modp;
              modp = VN_AS(modp->nextp(), NodeModule)) {
             std::vector<AstVar*>& varps = sortedVars[modp];
-            threadScope.enqueue([modp, &mTaskAffinity, &varps]() {
-                VariableOrder::processModule(modp, mTaskAffinity, varps);
+            threadScope.enqueue([modp, &mTaskAffinity, &hotVars, &threadWriters, &varps]() {
+                VariableOrder::processModule(modp, mTaskAffinity, hotVars, threadWriters,
+                                             varps);
             });
         }
     }
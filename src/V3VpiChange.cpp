@@ -0,0 +1,140 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Flag writes of public variables for VPI callbacks
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2003-2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3VpiChange's Transformations:
+//
+// Only with --vpi --vpi-change-flags. After descoping, for each public
+// module variable:
+//      If every write of the variable is by the left hand side of an
+//      assignment statement, create a flag variable in the same module,
+//      and set it after each such assignment:
+//          var = ...;
+//          __VvpiChanged__var = 1;
+//      The flag is registered with the variable's VerilatedVar, so VPI
+//      value change callbacks only compare the variable's value when the
+//      flag was set, and clear it.
+//      Otherwise the variable has no flag and is always compared.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3VpiChange.h"
+
+#include "V3Stats.h"
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class VpiChangeVisitor final {
+    // NODE STATE
+    //  AstVar::user1p()    -> AstNodeModule*: Module of candidate variable
+    //  AstVar::user2()     -> int: Number of writes
+    //  AstVar::user3()     -> int: Number of writes by the left hand side of an assignment
+    const VNUser1InUse m_user1InUse;
+    const VNUser2InUse m_user2InUse;
+    const VNUser3InUse m_user3InUse;
+
+    // STATE
+    std::vector<AstVar*> m_candidates;  // Candidate variables, in netlist order
+    // Assignments writing candidates, with the reference written
+    std::vector<std::pair<AstNodeAssign*, AstVarRef*>> m_writes;
+    VDouble0 m_statFlagged;  // Statistic tracking
+    VDouble0 m_statUnflagged;  // Statistic tracking
+
+    // METHODS
+    static bool isCandidate(const AstVar* varp) {
+        if (!varp->isSigUserRdPublic() && !varp->isSigUserRWPublic()) return false;
+        // Primary IO may be written directly by the harness, the others by
+        // means not visible as assignments
+        return !varp->isParam() && !varp->isPrimaryIO() && !varp->isForceable()
+               && !varp->isForced() && !varp->isWrittenByDpi() && !varp->isDpiOpenArray();
+    }
+
+    void findCandidates(AstNetlist* netlistp) {
+        const AstNodeModule* const constPoolModp = netlistp->constPoolp()->modp();
+        for (AstNode* nodep = netlistp->modulesp(); nodep; nodep = nodep->nextp()) {
+            AstNodeModule* const modp = VN_AS(nodep, NodeModule);
+            if (modp == constPoolModp || VN_IS(modp, Class)) continue;
+            for (AstNode* stmtp = modp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+                AstVar* const varp = VN_CAST(stmtp, Var);
+                if (!varp || !isCandidate(varp)) continue;
+                varp->user1p(modp);
+                m_candidates.push_back(varp);
+            }
+        }
+    }
+
+    void addFlag(AstVar* varp) {
+        UINFO(4, "VPI change flag " << varp);
+        AstVar* const flagp = new AstVar{varp->fileline(), VVarType::MODULETEMP,
+                                         "__VvpiChanged__" + varp->name(), varp->findBitDType()};
+        VN_AS(varp->user1p(), NodeModule)->addStmtsp(flagp);
+        varp->vpiChangedp(flagp);
+    }
+
+public:
+    // CONSTRUCTORS
+    explicit VpiChangeVisitor(AstNetlist* netlistp) {
+        findCandidates(netlistp);
+        if (m_candidates.empty()) return;
+        netlistp->foreach([](AstVarRef* refp) {
+            AstVar* const varp = refp->varp();
+            if (varp->user1p() && refp->access().isWriteOrRW()) varp->user2Inc();
+        });
+        netlistp->foreach([this](AstNodeAssign* assignp) {
+            assignp->lhsp()->foreach([&](AstVarRef* refp) {
+                AstVar* const varp = refp->varp();
+                if (!varp->user1p() || !refp->access().isWriteOrRW()) return;
+                varp->user3Inc();
+                m_writes.emplace_back(assignp, refp);
+            });
+        });
+        for (AstVar* const varp : m_candidates) {
+            if (varp->user2() != varp->user3()) {
+                ++m_statUnflagged;
+                continue;
+            }
+            addFlag(varp);
+            ++m_statFlagged;
+        }
+        for (const auto& pair : m_writes) {
+            AstNodeAssign* const assignp = pair.first;
+            const AstVarRef* const refp = pair.second;
+            AstVar* const flagp = refp->varp()->vpiChangedp();
+            if (!flagp) continue;
+            FileLine* const flp = assignp->fileline();
+            AstVarRef* const flagRefp
+                = new AstVarRef{flp, refp->classOrPackagep(), flagp, VAccess::WRITE};
+            flagRefp->selfPointer(refp->selfPointer());
+            assignp->addNextHere(
+                new AstAssign{flp, flagRefp, new AstConst{flp, AstConst::BitTrue{}}});
+        }
+    }
+    ~VpiChangeVisitor() {
+        V3Stats::addStat("Optimizations, VPI change flags", m_statFlagged);
+        V3Stats::addStat("Optimizations, VPI change flags not possible", m_statUnflagged);
+    }
+};
+
+//######################################################################
+// VpiChange class functions
+
+void V3VpiChange::vpiChangeAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { VpiChangeVisitor{nodep}; }  // Destruct before checking
+    V3Global::dumpCheckGlobalTree("vpichange", 0, dumpTreeEitherLevel() >= 3);
+}
@@ -18,6 +18,7 @@
 
 #include "V3Active.h"
 #include "V3ActiveTop.h"
+#include "V3ActivityGate.h"
 #include "V3Assert.h"
 #include "V3AssertPre.h"
 #include "V3AssertProp.h"
@@ -88,10 +89,12 @@
 #include "V3Reloop.h"
 #include "V3Reorder.h"
 #include "V3Sampled.h"
+#include "V3ScLazy.h"
 #include "V3Sched.h"
 #include "V3Scope.h"
 #include "V3Scoreboard.h"
 #include "V3Slice.h"
+#include "V3Sparse.h"
 #include "V3Split.h"
 #include "V3SplitAs.h"
 #include "V3SplitVar.h"
@@ -111,6 +114,7 @@
 #include "V3Unknown.h"
 #include "V3Unroll.h"
 #include "V3VariableOrder.h"
+#include "V3VpiChange.h"
 #include "V3Waiver.h"
 #include "V3Width.h"
 #include "V3WidthCommit.h"
@@ -125,6 +129,7 @@ static void reportStatsIfEnabled() {
     if (v3Global.opt.stats()) {
         FileLine::stats();
         V3Stats::statsFinalAll(v3Global.rootp());
+        if (v3Global.opt.statsTimeline()) V3Stats::timelineReport();
         V3Stats::statsReport();
     }
 }
@@ -141,6 +146,12 @@ static void emitSerialized() VL_MT_DISABLED {
     if (v3Global.opt.jsonOnly()) emitJson();
 }
 
+static bool emitReleases() {
+    // Whether emitters may free AST subtrees as soon as their C++ text is written.
+    // Only the final tree checks and dumps need the netlist intact after emitting.
+    return !v3Global.opt.debugCheck() && !dumpTreeEitherLevel();
+}
+
 static void process() {
     {
         VlOs::DeltaWallTime elabWallTime{true};
@@ -458,6 +469,14 @@ static void process() {
             // Remove SAMPLED
             if (v3Global.hasSampled()) V3Sampled::sampledAll(v3Global.rootp());
 
+            // Skip large combinational blocks when their inputs are unchanged
+            if (v3Global.opt.activityGating()) V3ActivityGate::activityGateAll(v3Global.rootp());
+
+            // Find outputs the --lib-create wrapper need not update combinationally
+            if (!v3Global.opt.libCreate().empty() && v3Global.opt.libCreateSummary()) {
+                V3ProtectLib::findRegisteredOutputs(v3Global.rootp());
+            }
+
             if (v3Global.opt.stats()) V3Stats::statsStageAll(v3Global.rootp(), "PreOrder");
 
             // Schedule the logic
@@ -516,6 +535,11 @@ static void process() {
         // --GENERATION------------------
 
         if (!v3Global.opt.serializeOnly()) {
+            // Only write SystemC output ports when they change
+            if (v3Global.opt.systemC() && v3Global.opt.pinsScLazy()) {
+                V3ScLazy::scLazyAll(v3Global.rootp());
+            }
+
             // Generic optimizations on a per-function basis
             if (v3Global.opt.fFunc()) V3FuncOpt::funcOptAll(v3Global.rootp());
 
@@ -579,6 +603,11 @@ static void process() {
             // Add C casts when longs need to become long-long and vice-versa
             // Note depth may insert something needing a cast, so this must be last.
             V3Cast::castAll(v3Global.rootp());
+
+            // Flag writes of public variables, so VPI need not compare unchanged values
+            if (v3Global.opt.vpi() && v3Global.opt.vpiChangeFlags()) {
+                V3VpiChange::vpiChangeAll(v3Global.rootp());
+            }
         }
 
         V3Error::abortIfErrors();
@@ -598,6 +627,9 @@ static void process() {
             // Add common methods/etc to modules
             V3Common::commonAll();
 
+            // Allocate large arrays on demand
+            V3Sparse::sparseAll(v3Global.rootp());
+
             // Order variables
             V3VariableOrder::orderAll(v3Global.rootp());
 
@@ -616,7 +648,7 @@ static void process() {
             // emitcInlines is first, as it may set needHInlines which other emitters read
             V3EmitC::emitcInlines();
             V3EmitC::emitcSyms();
-            V3EmitC::emitcConstPool();
+            V3EmitC::emitcConstPool(emitReleases());
             V3EmitC::emitcModel();
             V3EmitC::emitcPch();
             V3EmitC::emitcHeaders();
@@ -629,7 +661,7 @@ static void process() {
     }
     if (!v3Global.opt.serializeOnly()
         && !v3Global.opt.dpiHdrOnly()) {  // Unfortunately we have some lint checks in emitcImp.
-        V3EmitC::emitcImp();
+        V3EmitC::emitcImp(emitReleases());
     }
     if (v3Global.opt.serializeOnly()) {
         emitSerialized();
@@ -845,11 +877,13 @@ static void execHierVerilation() {
     const string target = v3Global.opt.build() ? " hier_build" : " hier_verilation";
     const string cmdStr = buildMakeCmd(makefile, target);
     V3Os::filesystemFlushBuildDir(v3Global.opt.hierTopDataDir());
+    v3Global.hierGraphp()->restoreCachedBlocks();
     const int exit_code = V3Os::system(cmdStr);
     if (exit_code != 0) {
         v3error(cmdStr << " exited with " << exit_code << std::endl);
         v3Global.vlExit(exit_code);
     }
+    v3Global.hierGraphp()->storeCachedBlocks();
 }
 
 //######################################################################
@@ -880,11 +914,13 @@ int main(int argc, char** argv) {
     // Validate settings (aka Boost.Program_options)
     v3Global.opt.notify();
     v3Global.rootp()->timeInit();
+    VNVisitorConst::countVisits(v3Global.opt.statsTimeline());
 
     V3Error::abortIfErrors();
 
     bool didVerilate = false;
     if (v3Global.opt.verilate()) {
+        const V3StatsTimer statsTimer{"verilate"};
         didVerilate = verilate(argString);
     } else {
         UINFO(1, "Option --no-verilate: Skip Verilation");
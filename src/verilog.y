@@ -245,6 +245,8 @@ BISONPRE_VERSION(3.7,%define api.header.include {"V3ParseBison.h"})
 %token<fl>              yVLT_COVERAGE_BLOCK_OFF     "coverage_block_off"
 %token<fl>              yVLT_COVERAGE_OFF           "coverage_off"
 %token<fl>              yVLT_COVERAGE_ON            "coverage_on"
+%token<fl>              yVLT_DPI_NATIVE             "dpi_native"
+%token<fl>              yVLT_DPI_THREAD_SAFE        "dpi_thread_safe"
 %token<fl>              yVLT_FORCEABLE              "forceable"
 %token<fl>              yVLT_FULL_CASE              "full_case"
 %token<fl>              yVLT_HIER_BLOCK             "hier_block"
@@ -266,6 +268,7 @@ BISONPRE_VERSION(3.7,%define api.header.include {"V3ParseBison.h"})
 %token<fl>              yVLT_SC_BIGUINT             "sc_biguint"
 %token<fl>              yVLT_SC_BV                  "sc_bv"
 %token<fl>              yVLT_SFORMAT                "sformat"
+%token<fl>              yVLT_SPARSE                 "sparse"
 %token<fl>              yVLT_SPLIT_VAR              "split_var"
 %token<fl>              yVLT_TIMING_OFF             "timing_off"
 %token<fl>              yVLT_TIMING_ON              "timing_on"
@@ -802,6 +805,7 @@ BISONPRE_VERSION(3.7,%define api.header.include {"V3ParseBison.h"})
 %token<fl>              yVL_SC_BIGUINT            "/*verilator sc_biguint*/"
 %token<fl>              yVL_SC_BV                 "/*verilator sc_bv*/"
 %token<fl>              yVL_SFORMAT               "/*verilator sformat*/"
+%token<fl>              yVL_SPARSE                "/*verilator sparse*/"
 %token<fl>              yVL_SPLIT_VAR             "/*verilator split_var*/"
 %token<strp>            yVL_TAG                   "/*verilator tag*/"
 %token<fl>              yVL_UNROLL_DISABLE        "/*verilator unroll_disable*/"
@@ -3106,6 +3110,7 @@ sigAttr<nodep>:
         |       yVL_SC_BIGUINT                          { $$ = new AstAttrOf{$1, VAttrType::VAR_SC_BIGUINT}; }
         |       yVL_SC_BV                               { $$ = new AstAttrOf{$1, VAttrType::VAR_SC_BV}; }
         |       yVL_SFORMAT                             { $$ = new AstAttrOf{$1, VAttrType::VAR_SFORMAT}; }
+        |       yVL_SPARSE                              { $$ = new AstAttrOf{$1, VAttrType::VAR_SPARSE}; }
         |       yVL_SPLIT_VAR                           { $$ = new AstAttrOf{$1, VAttrType::VAR_SPLIT_VAR}; }
         ;
 
@@ -8173,6 +8178,10 @@ vltItem:
                         { /* Historical, now has no effect */ }
         |       vltInlineFront vltDModuleE vltDFTaskE
                         { V3Control::addInline($<fl>1, *$2, *$3, $1); }
+        |       yVLT_DPI_NATIVE vltDModuleE vltDFTaskE
+                        { V3Control::addDpiNative($<fl>1, *$2, *$3); }
+        |       yVLT_DPI_THREAD_SAFE vltDModuleE vltDFTaskE
+                        { V3Control::addDpiThreadSafe($<fl>1, *$2, *$3); }
         |       yVLT_COVERAGE_BLOCK_OFF vltDFile
                         { V3Control::addCoverageBlockOff(*$2, 0); }
         |       yVLT_COVERAGE_BLOCK_OFF vltDFile yVLT_D_LINES yaINTNUM
@@ -8308,6 +8317,7 @@ vltVarAttrFront<attrtypeen>:
         |       yVLT_SC_BIGUINT             { $$ = VAttrType::VAR_SC_BIGUINT; }
         |       yVLT_SC_BV                  { $$ = VAttrType::VAR_SC_BV; }
         |       yVLT_SFORMAT                { $$ = VAttrType::VAR_SFORMAT; }
+        |       yVLT_SPARSE                 { $$ = VAttrType::VAR_SPARSE; }
         |       yVLT_SPLIT_VAR              { $$ = VAttrType::VAR_SPLIT_VAR; }
         ;
 
@@ -0,0 +1,106 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer      cyc = 0;
+   reg [63:0]   crc;
+
+   // Mostly hit the decoded values, sometimes random
+   wire [31:0]  insn = crc[2] ? crc[63:32] : {crc[31:27], 27'h0} + {28'h0, crc[5:3]};
+   wire [7:0]   op = crc[15:8];
+
+   reg [7:0]    dec;
+   reg [7:0]    dec_ref;
+   reg [7:0]    sparse;
+   reg [7:0]    sparse_ref;
+
+   // Wide selector, too wide for a parallel case tree
+   always_comb begin
+      case (insn)
+        32'h0000_0000: dec = 8'd1;
+        32'h0800_0000: dec = 8'd2;
+        32'h1000_0000: dec = 8'd3;
+        32'h1800_0001: dec = 8'd4;
+        32'h2000_0002, 32'h2800_0003: dec = 8'd5;
+        32'h3000_0004: dec = 8'd6;
+        32'h3800_0005: dec = 8'd7;
+        32'h4000_0006: dec = 8'd8;
+        32'h4800_0007: dec = 8'd9;
+        32'h5000_0000: dec = 8'd10;
+        32'h8800_0001: dec = 8'd11;
+        32'hf800_0002: dec = 8'd12;
+        default: dec = insn[7:0] ^ insn[31:24];
+      endcase
+   end
+   always_comb begin
+      if (insn == 32'h0000_0000) dec_ref = 8'd1;
+      else if (insn == 32'h0800_0000) dec_ref = 8'd2;
+      else if (insn == 32'h1000_0000) dec_ref = 8'd3;
+      else if (insn == 32'h1800_0001) dec_ref = 8'd4;
+      else if (insn == 32'h2000_0002 || insn == 32'h2800_0003) dec_ref = 8'd5;
+      else if (insn == 32'h3000_0004) dec_ref = 8'd6;
+      else if (insn == 32'h3800_0005) dec_ref = 8'd7;
+      else if (insn == 32'h4000_0006) dec_ref = 8'd8;
+      else if (insn == 32'h4800_0007) dec_ref = 8'd9;
+      else if (insn == 32'h5000_0000) dec_ref = 8'd10;
+      else if (insn == 32'h8800_0001) dec_ref = 8'd11;
+      else if (insn == 32'hf800_0002) dec_ref = 8'd12;
+      else dec_ref = insn[7:0] ^ insn[31:24];
+   end
+
+   // Narrow, but too few items for a parallel case tree
+   always_comb begin
+      case (op)
+        8'd3: sparse = 8'd30;
+        8'd17: sparse = 8'd31;
+        8'd18: sparse = 8'd32;
+        8'd40: sparse = 8'd33;
+        8'd64: sparse = 8'd34;
+        8'd65: sparse = 8'd35;
+        8'd128: sparse = 8'd36;
+        8'd200: sparse = 8'd37;
+        8'd255: sparse = 8'd38;
+        default: sparse = 8'hff;
+      endcase
+   end
+   always_comb begin
+      sparse_ref = 8'hff;
+      if (op == 8'd3) sparse_ref = 8'd30;
+      if (op == 8'd17) sparse_ref = 8'd31;
+      if (op == 8'd18) sparse_ref = 8'd32;
+      if (op == 8'd40) sparse_ref = 8'd33;
+      if (op == 8'd64) sparse_ref = 8'd34;
+      if (op == 8'd65) sparse_ref = 8'd35;
+      if (op == 8'd128) sparse_ref = 8'd36;
+      if (op == 8'd200) sparse_ref = 8'd37;
+      if (op == 8'd255) sparse_ref = 8'd38;
+   end
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+`ifdef TEST_VERBOSE
+      $write("[%0t] cyc==%0d insn=%x dec=%x op=%x sparse=%x\n",
+             $time, cyc, insn, dec, op, sparse);
+`endif
+      if (cyc == 0) begin
+         crc <= 64'h5aef0c8d_d70a4497;
+      end
+      else begin
+         if (dec !== dec_ref) $stop;
+         if (sparse !== sparse_ref) $stop;
+         if (cyc == 999) begin
+            $write("*-* All Finished *-*\n");
+            $finish;
+         end
+      end
+   end
+endmodule
@@ -0,0 +1,116 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_cosim.h"
+#include "verilated_vpi.h"
+
+#include "TestVpi.h"
+#include "Vt_cosim.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+static constexpr size_t CYCLES = 1000;
+static constexpr size_t STIM_BYTES = 2 + 5;  // a, b
+static constexpr size_t RESP_BYTES = 5 + 4;  // sum, count
+
+static vpiHandle handle(const char* namep) {
+    return vpi_handle_by_name(const_cast<PLI_BYTE8*>(namep), nullptr);
+}
+
+static uint64_t stimA(size_t cycle) { return (cycle * 7919) & 0xffff; }
+static uint64_t stimB(size_t cycle) { return (cycle * 0x9e3779b9ULL) & 0xffffffffffULL; }
+
+// Client side, returns failing line number, or 0
+static int client(VerilatedCosimChannel* chanp) {
+    CHECK_RESULT(chanp->stimBytes(), STIM_BYTES);
+    CHECK_RESULT(chanp->respBytes(), RESP_BYTES);
+    CHECK_RESULT(chanp->depth(), 64U);
+
+    uint8_t stim[CYCLES * STIM_BYTES] = {};
+    uint8_t resp[CYCLES * RESP_BYTES] = {};
+    for (size_t i = 0; i < CYCLES; ++i) {
+        const uint64_t a = stimA(i);
+        const uint64_t b = stimB(i);
+        std::memcpy(stim + i * STIM_BYTES, &a, 2);
+        std::memcpy(stim + i * STIM_BYTES + 2, &b, 5);
+    }
+    // First cycle on its own, then batches larger than the rings
+    chanp->pushStimulusAll(stim, 1);
+    chanp->pullResponsesAll(resp, 1);
+    chanp->exchange(stim + STIM_BYTES, resp + RESP_BYTES, CYCLES - 1);
+
+    for (size_t i = 0; i < CYCLES; ++i) {
+        uint64_t sum = 0;
+        uint32_t count = 0;
+        std::memcpy(&sum, resp + i * RESP_BYTES, 5);
+        std::memcpy(&count, resp + i * RESP_BYTES + 5, 4);
+        CHECK_RESULT_HEX(sum, (stimA(i) + stimB(i)) & 0xffffffffffULL);
+        CHECK_RESULT(count, i + 1);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(),
+                                                        // Note null name - we're flattening it out
+                                                        ""}};
+    topp->eval();
+
+    VerilatedVpiBulk inputs;
+    inputs.add(handle("t.a"));
+    inputs.add(handle("t.b"));
+    VerilatedVpiBulk outputs;
+    outputs.add(handle("t.sum"));
+    outputs.add(handle("t.count"));
+
+    const std::string name = "vl_t_cosim_" + std::to_string(getpid());
+    if (VerilatedCosimChannel::open(name)) {
+        printf("%%Error: Opened channel before creation\n");
+        return 1;
+    }
+    const std::unique_ptr<VerilatedCosimChannel> chanp
+        = VerilatedCosimChannel::create(name, inputs.bytes(), outputs.bytes(), 50);
+    if (!chanp) {
+        printf("%%Error: Cannot create channel\n");
+        return 1;
+    }
+
+    int clientLine = 0;
+    std::thread clientThread{[&]() {
+        const std::unique_ptr<VerilatedCosimChannel> clientp = VerilatedCosimChannel::open(name);
+        clientLine = clientp ? client(clientp.get()) : __LINE__;
+        if (clientp) clientp->close();  // Even on failure, so serve() returns
+    }};
+    const uint64_t served = chanp->serve(inputs, outputs, [&]() {
+        topp->clk = 1;
+        topp->eval();
+        topp->clk = 0;
+        topp->eval();
+    });
+    clientThread.join();
+    if (clientLine) {
+        printf("%%Error: Failure at line %d\n", clientLine);
+        return 1;
+    }
+    if (served != CYCLES) {
+        printf("%%Error: Served %" PRIu64 " cycles\n", served);
+        return 1;
+    }
+    topp->final();
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
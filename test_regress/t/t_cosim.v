@@ -0,0 +1,24 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    clk
+);
+
+  input clk;
+
+  logic [15:0] a  /*verilator public_flat_rw*/;
+  logic [39:0] b  /*verilator public_flat_rw*/;
+
+  logic [39:0] sum  /*verilator public_flat_rd*/;
+  logic [31:0] count  /*verilator public_flat_rd*/ = 0;
+
+  always @(posedge clk) begin
+    sum <= b + {24'd0, a};
+    count <= count + 1;
+  end
+
+endmodule
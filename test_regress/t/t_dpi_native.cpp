@@ -0,0 +1,41 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "svdpi.h"
+
+#include "Vt_dpi_native__Dpi.h"
+
+//======================================================================
+// Results deliberately overflow their width; the caller must mask them
+
+uint8_t nat_add5(uint8_t a, uint8_t b) { return a + b; }
+
+uint16_t nat_inv12(uint16_t a) { return ~a; }
+
+uint64_t nat_shl40(uint64_t a, uint64_t* o) {
+    *o = a << 2;
+    return a << 1;
+}
+
+int nat_mix(int i, uint16_t s, uint8_t* io) {
+    *io += 5;
+    return i + s;
+}
+
+int nat_wide(const uint32_t* i, uint32_t* o, uint32_t* io) {
+    o[0] = i[0] + 1;
+    o[1] = i[1];
+    o[2] = i[2] | 0xffffffc0U;
+    for (int w = 0; w < 3; ++w) io[w] = ~io[w];
+    return 0;
+}
+
+svBitVecVal std_add5(const svBitVecVal* a, const svBitVecVal* b) { return *a + *b; }
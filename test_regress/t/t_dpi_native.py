@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(v_flags2=["t/" + test.name + ".cpp"],
+             verilator_flags2=["-Wall -Wno-DECLFILENAME", "t/" + test.name + ".vlt"])
+
+dpi_h = test.obj_dir + "/" + test.vm_prefix + "__Dpi.h"
+test.file_grep(dpi_h, r'extern uint8_t nat_add5\(uint8_t a, uint8_t b\);')
+test.file_grep(dpi_h, r'extern uint16_t nat_inv12\(uint16_t a\);')
+test.file_grep(dpi_h, r'extern uint64_t nat_shl40\(uint64_t a, uint64_t\* o\);')
+test.file_grep(dpi_h, r'extern int nat_mix\(int i, uint16_t s, uint8_t\* io\);')
+test.file_grep(dpi_h,
+               r'extern int nat_wide\(const uint32_t\* i, uint32_t\* o, uint32_t\* io\);')
+test.file_grep(dpi_h,
+               r'extern svBitVecVal std_add5\(const svBitVecVal\* a, const svBitVecVal\* b\);')
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,48 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+// verilog_format: off
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0x exp=%0x (%s !== %s)\n", `__FILE__,`__LINE__, (gotv), (expv), `"gotv`", `"expv`"); `stop; end while(0);
+// verilog_format: on
+
+module t;
+  // Native, narrow vectors and return values
+  import "DPI-C" function bit [4:0] nat_add5(input bit [4:0] a, input bit [4:0] b);
+  import "DPI-C" function logic [11:0] nat_inv12(input logic [11:0] a);
+  import "DPI-C" function bit [39:0] nat_shl40(input bit [39:0] a, output bit [39:0] o);
+  // Native, mixed with DPI primitive types
+  import "DPI-C" function int nat_mix(input int i, input bit [15:0] s, inout bit [2:0] io);
+  // Native, wide vectors
+  import "DPI-C" task nat_wide(input bit [69:0] i, output bit [69:0] o, inout logic [95:0] io);
+  // Not native, for comparison
+  import "DPI-C" function bit [4:0] std_add5(input bit [4:0] a, input bit [4:0] b);
+
+  bit [39:0] o40;
+  bit [2:0] io3;
+  bit [69:0] o70;
+  logic [95:0] io96;
+
+  initial begin
+    // Results computed in C overflow their width, and must be masked
+    `checkh(nat_add5(5'h1f, 5'h03), 5'h02);
+    `checkh(std_add5(5'h1f, 5'h03), 5'h02);
+    `checkh(nat_inv12(12'h0f0), 12'hf0f);
+    `checkh(nat_shl40(40'h80_0000_0001, o40), 40'h00_0000_0002);
+    `checkh(o40, 40'h00_0000_0004);
+    io3 = 3'h5;
+    `checkh(nat_mix(100, 16'h1234, io3), 100 + 32'h1234);
+    `checkh(io3, 3'h2);
+    io96 = 96'h0123_4567_89ab_cdef_0011_2233;
+    nat_wide(70'h3f_0000_0000_0000_0001, o70, io96);
+    `checkh(o70, 70'h00_0000_0000_0000_0002);
+    `checkh(io96, 96'hfedc_ba98_7654_3210_ffee_ddcc);
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_dpi_threads.v"
+
+test.skip_if_too_few_cores()
+
+test.compile(v_flags2=["t/t_dpi_threads_c.cpp --no-threads-coarsen", "t/" + test.name + ".vlt"])
+
+# Like t_dpi_threads_collide, but under the default --threads-dpi pure, as
+# the import marked dpi_thread_safe is no longer serialized the race is
+# detected
+test.execute(fails=True)
+
+test.passes()
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_opt_table_packed_array.v"
+
+# Netlist is only released when not checking the final tree
+test.compile(verilator_flags2=["--stats --no-debug-check --coverage-line --trace-vcd"])
+
+if test.vlt_all:
+    test.file_grep(test.stats, r'ConstPool, Tables emitted\s+(\d+)', 1)
+    test.file_grep(test.stats, r'Emit, Function bodies released\s+(\d+)')
+    test.file_grep(test.stats, r'Stage, Memory peak \(MB\), \d+_emit-imp\s+')
+
+test.execute(expect_filename="t/t_opt_table_packed_array.out")
+
+test.passes()
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_csplit.v"
+
+test.compile(verilator_flags2=["--stats", "--build-jobs", "2", "--output-split", "100"])
+
+test.execute()
+
+test.file_grep(test.stats, r'Build prediction, compile cost, total\s+\d+')
+test.file_grep(test.stats, r'Build prediction, compile cost, largest file\s+\d+')
+test.file_grep(test.stats, r'Build prediction, compile cost, critical path\s+\d+')
+
+test.passes()
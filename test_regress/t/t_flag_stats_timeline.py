@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_stats.v"
+
+test.compile(verilator_flags2=["--stats-timeline --threads 2"])
+
+timeline = test.obj_dir + "/" + test.vm_prefix + "__stats_timeline.json"
+test.file_grep(timeline, r'"traceEvents"')
+test.file_grep(timeline, r'"cat": *"stage"')
+test.file_grep(timeline, r'"name": *"GateInline"')
+test.file_grep(test.stats, r'Timer, Calls, GateInline\s+\d+')
+test.file_grep(test.stats, r'Timer, Total time \(sec\), GateInline\s+[\d.]+')
+test.file_grep(test.stats, r'Visits, GateBuildVisitor, NETLIST\s+\d+')
+test.file_grep(test.stats, r'Visits, GateBuildVisitor, TOTAL\s+\d+')
+
+test.execute()
+
+test.passes()
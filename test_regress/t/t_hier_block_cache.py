@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.priority(30)
+test.scenarios('vlt_all')
+test.top_filename = "t/t_hier_block.v"
+
+# stats will be deleted but generation will be skipped if libs of hierarchical blocks exist.
+test.clean_objs()
+
+# CI environment offers 2 VCPUs, 2 thread setting causes the following warning.
+# %Warning-UNOPTTHREADS: Thread scheduler is unable to provide requested parallelism; consider asking for fewer threads.
+# So use 6 threads here though it's not optimal in performance, but ok.
+
+flags = [
+    '--stats',
+    '--hierarchical',
+    '--hierarchical-cache',
+    test.obj_dir + '/hier_cache',
+    '--Wno-TIMESCALEMOD',  #
+    '-GPARAM_A=100',
+    '-pvalue+PARAM_B=200',
+    '-DPARAM_OVERRIDE',  #
+    '--CFLAGS',
+    '"-pipe -DCPP_MACRO=cplusplus"'
+]
+
+# First run populates the cache
+test.compile(v_flags2=['t/t_hier_block.cpp'],
+             verilator_flags2=flags,
+             threads=(6 if test.vltmt else 1))
+
+# Second run, into another output directory, reuses every block
+other_dir = test.obj_dir + "/other"
+test.mkdir_ok(other_dir)
+test.compile(verilator_flags=["-cc", "-Mdir", other_dir, "--debug-check"],
+             verilator_flags2=flags,
+             verilator_make_gmake=False,
+             make_main=False,
+             make_top_shell=False,
+             threads=(6 if test.vltmt else 1))
+test.file_grep(other_dir + "/" + test.vm_prefix + "__stats.txt",
+               r'HierBlock,\s+Blocks from cache\s+(\d+)', 14)
+# Restored blocks are not Verilated again
+test.file_grep_not(test.compile_log_filename, r'Vsub0__hierMkArgs\.f')
+
+test.execute()
+
+test.file_grep(test.obj_dir + "/Vsub0/sub0.sv", r'^\s+\/\/\s+timeprecision\s+(\d+)ps;', 1)
+test.file_grep(test.obj_dir + "/Vsub0/sub0.sv", r'^module\s+(\S+)\s+', "sub0")
+test.file_grep(test.obj_dir + "/Vsub1/sub1.sv", r'^module\s+(\S+)\s+', "sub1")
+test.file_grep(test.obj_dir + "/Vsub2/sub2.sv", r'^module\s+(\S+)\s+', "sub2")
+test.file_grep(test.stats, r'HierBlock,\s+Hierarchical blocks\s+(\d+)', 14)
+test.file_grep(test.run_log_filename, r'MACRO:(\S+) is defined', "cplusplus")
+
+test.passes()
@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.priority(30)
+test.scenarios('vlt_all')
+
+# stats will be deleted but generation will be skipped if libs of hierarchical blocks exist.
+test.clean_objs()
+
+test.compile(verilator_flags2=['--stats', '--hierarchical', '--lib-create-summary'],
+             threads=(2 if test.vltmt else 1))
+
+test.execute()
+
+wrapper = test.obj_dir + "/Vsub/sub.sv"
+
+# The combinational output is still updated by the combinational process
+test.file_grep(wrapper, r'\bcomb_out_combo__V\b')
+test.file_grep(wrapper, r'\bcomb_out = comb_out_combo__V;')
+
+# The output of the flop, even with an asynchronous reset, is only updated on clock edges
+test.file_grep_not(wrapper, r'\bflop_out_combo__V\b')
+test.file_grep(wrapper, r'\bflop_out = flop_out_seq__V;')
+
+test.file_grep(test.obj_dir + "/Vsub/Vsub__stats.txt",
+               r'Optimizations, Lib registered outputs\s+(\d+)', 1)
+
+test.passes()
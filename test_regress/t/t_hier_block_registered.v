@@ -0,0 +1,72 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  int cyc = 0;
+  logic rst_n = 1'b0;
+  logic [7:0] in = 8'h11;
+  wire [7:0] comb_out;
+  wire [7:0] flop_out;
+  logic [7:0] flop_ref;
+
+  sub u_sub (
+      .clk(clk),
+      .rst_n(rst_n),
+      .in(in),
+      .comb_out(comb_out),
+      .flop_out(flop_out)
+  );
+
+  // Reference for the registered output
+  always @(posedge clk or negedge rst_n) begin
+    if (!rst_n) flop_ref <= '0;
+    else flop_ref <= in ^ 8'h5a;
+  end
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    in <= in * 8'd3 + 8'd1;
+    // Reset at the start, and again in the middle
+    if (cyc == 2) rst_n <= 1'b1;
+    if (cyc == 10) rst_n <= 1'b0;
+    if (cyc == 12) rst_n <= 1'b1;
+`ifdef TEST_VERBOSE
+    $write("[%0t] cyc=%0d rst_n=%b in=%x comb_out=%x flop_out=%x flop_ref=%x\n", $time, cyc,
+           rst_n, in, comb_out, flop_out, flop_ref);
+`endif
+    if (cyc > 0) begin
+      if (comb_out !== in + 8'd1) $stop;
+      if (flop_out !== flop_ref) $stop;
+    end
+    if (cyc == 20) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
+
+module sub (  /*verilator hier_block*/
+    input clk,
+    input rst_n,
+    input [7:0] in,
+    output [7:0] comb_out,
+    output logic [7:0] flop_out
+);
+
+  // Combinational path from input to output
+  assign comb_out = in + 8'd1;
+
+  // Registered output, with an asynchronous reset
+  always @(posedge clk or negedge rst_n) begin
+    if (!rst_n) flop_out <= '0;
+    else flop_out <= in ^ 8'h5a;
+  end
+
+endmodule
@@ -0,0 +1,54 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0x exp=%0x (%s !== %s)\n", `__FILE__,`__LINE__, (gotv), (expv), `"gotv`", `"expv`"); `stop; end while(0);
+// verilog_format: on
+
+module t (
+    input clk
+);
+
+  int cyc = 0;
+  logic [63:0] crc = 64'h5aef0c8d_d70a4497;
+  logic [31:0] sel = '0;
+  logic [31:0] data = '0;
+  logic [31:0] result;
+
+  function automatic logic [31:0] mix(logic [31:0] s, logic [31:0] d);
+    logic [31:0] r = d;
+    for (int i = 0; i < 16; ++i) begin
+      if (s[i]) r = {r[30:0], r[31]} ^ (r + 32'h9e3779b9);
+      else r = r - {r[15:0], r[31:16]};
+    end
+    return r;
+  endfunction
+
+  // Large block with few inputs, which only change every 8th cycle
+  always_comb begin
+    result = data;
+    for (int i = 0; i < 16; ++i) begin
+      if (sel[i]) result = {result[30:0], result[31]} ^ (result + 32'h9e3779b9);
+      else result = result - {result[15:0], result[31:16]};
+    end
+  end
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+    if (cyc[2:0] == 0) begin
+      sel <= crc[31:0];
+      data <= crc[63:32];
+    end
+    `checkh(result, mix(sel, data));
+    if (cyc == 99) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
@@ -0,0 +1,56 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0x exp=%0x (%s !== %s)\n", `__FILE__,`__LINE__, (gotv), (expv), `"gotv`", `"expv`"); `stop; end while(0);
+// verilog_format: on
+
+module t (
+    input clk
+);
+
+  int cyc = 0;
+  logic [63:0] crc = 64'h5aef0c8d_d70a4497;
+
+  wire s0 = crc[0];
+  wire s1 = crc[7] ^ crc[13];
+  wire [31:0] a = crc[31:0];
+  wire [31:0] b = crc[63:32];
+  wire [63:0] q = {crc[31:0], crc[63:32]};
+
+  // Conditionals cheap enough to be emitted branch free
+  wire [31:0] c0 = s0 ? a : b;
+  wire [31:0] c1 = s1 ? a + b : a ^ b;
+  wire [15:0] c2 = s0 ? a[15:0] - 16'd3 : ~b[31:16];
+  wire [63:0] c3 = s1 ? q : crc;
+  wire [6:0] c4 = (a[3:0] > b[3:0]) ? a[6:0] : b[6:0];
+
+  // Reference values using masks, not conditionals
+  wire [31:0] m0 = {32{s0}};
+  wire [31:0] m1 = {32{s1}};
+  wire [31:0] e0 = (a & m0) | (b & ~m0);
+  wire [31:0] e1 = ((a + b) & m1) | ((a ^ b) & ~m1);
+  wire [15:0] e2 = ((a[15:0] - 16'd3) & m0[15:0]) | (~b[31:16] & ~m0[15:0]);
+  wire [63:0] e3 = (q & {m1, m1}) | (crc & ~{m1, m1});
+  wire [6:0] m4 = {7{a[3:0] > b[3:0]}};
+  wire [6:0] e4 = (a[6:0] & m4) | (b[6:0] & ~m4);
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+    `checkh(c0, e0);
+    `checkh(c1, e1);
+    `checkh(c2, e2);
+    `checkh(c3, e3);
+    `checkh(c4, e4);
+    if (cyc == 99) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
@@ -0,0 +1,53 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0x exp=%0x (%s !== %s)\n", `__FILE__,`__LINE__, (gotv), (expv), `"gotv`", `"expv`"); `stop; end while(0);
+// verilog_format: on
+
+module t (
+    input clk
+);
+
+  int cyc = 0;
+  logic [31:0] mem[0:7];
+  logic [31:0] idx = 0;
+  logic [7:0] bidx = 0;
+  logic [63:0] wide = 64'h01234567_89abcdef;
+
+  // Out of range reads must not be evaluated when not selected
+  wire in_range = idx < 8;
+  wire [31:0] rd = in_range ? mem[idx] : 32'h5;
+  wire [31:0] rd_guard = mem[idx];
+  wire bit_rd = (bidx < 64) ? wide[bidx] : 1'b0;
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    mem[cyc[2:0]] <= cyc * 3;
+    // Alternate between in range, and far out of range indices
+    idx <= cyc[0] ? 32'h4000_0000 + cyc : {29'b0, cyc[3:1]};
+    bidx <= cyc[0] ? 8'hf0 : {2'b0, cyc[6:1]};
+    if (cyc > 10) begin
+      if (idx < 8) begin
+        `checkh(rd, mem[idx[2:0]]);
+        `checkh(rd_guard, mem[idx[2:0]]);
+      end else begin
+        `checkh(rd, 32'h5);
+      end
+      if (bidx < 64) begin
+        `checkh(bit_rd, wide[bidx[5:0]]);
+      end else begin
+        `checkh(bit_rd, 1'b0);
+      end
+    end
+    if (cyc == 99) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import re
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+
+
+def mtask_count(text):
+    return sum(int(n) for n in re.findall(r'MTask graph, final, mtask count\s+(\d+)', text))
+
+
+test.compile(verilator_flags2=["--stats", "--no-threads-coarsen"], threads=2)
+
+# Read directly, as file_contents caches and the stats file is rewritten below
+with open(test.stats, 'r', encoding='latin-1') as fh:
+    uncoarsened = mtask_count(fh.read())
+
+test.compile(verilator_flags2=["--stats", "--debug-partition"], threads=2)
+
+# Each lane is a chain of MTasks, merged before Contraction
+test.file_grep(test.stats, r'MTask graph, chain merges\s+[1-9]')
+
+coarsened = mtask_count(test.file_contents(test.stats))
+if coarsened >= uncoarsened:
+    test.error("MTask count not reduced by coarsening: " + str(coarsened) + " vs " +
+               str(uncoarsened) + " with --no-threads-coarsen")
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,50 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  int cyc = 0;
+
+  function automatic logic [31:0] stage(logic [31:0] v, int n);
+    logic [31:0] x = v;
+    for (int i = 0; i < 6; ++i) x = {x[30:0], x[31] ^ x[21]} ^ (x >> 3) ^ n;
+    return x;
+  endfunction
+
+  // Independent lanes, each a serial chain of combinational stages
+  for (genvar k = 0; k < 4; ++k) begin : g_lane
+    logic [31:0] in = 32'h1234_5678 * (k + 1);
+    logic [31:0] s1, s2, s3, s4;
+    logic [31:0] out = '0;
+    logic [31:0] expected = '0;
+
+    always_comb s1 = stage(in, 1);
+    always_comb s2 = stage(s1, 2);
+    always_comb s3 = stage(s2, 3);
+    always_comb s4 = stage(s3, 4);
+
+    always @(posedge clk) begin
+      in <= in + 32'd1;
+      out <= s4;
+      expected <= stage(stage(stage(stage(in, 1), 2), 3), 4);
+      if (cyc > 0 && out != expected) begin
+        $write("%%Error: lane %0d out=%x expected=%x\n", k, out, expected);
+        $stop;
+      end
+    end
+  end
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    if (cyc == 20) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
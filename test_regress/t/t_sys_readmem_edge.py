@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import os
+import threading
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+
+def gen(name, contents):
+    # Generate using file to keep line endings and missing newlines out of repository
+    with open(test.obj_dir + "/" + name, 'wb') as fh:
+        fh.write(contents.encode())
+
+
+gen("noeol.mem", "// No newline at end\n1\n10\n20\n30")
+gen("noeol_wide.mem", "123456789abcdef0123456789\nfedcba98765432100fedcba98")
+gen("crlf.mem", "11\r\n22\r\n// Comment\r\n33\r\n/* Block\r\ncomment */ 44\r\n")
+gen("crlf_bin.mem", "1010\r\n0101\r\n1111\r\n")
+gen("eof_comment.mem", "aa\nbb\n// Comment without newline")
+gen("eof_addr.mem", "@1\ncc\ndd\n@5")
+gen("empty.mem", "")
+
+flags = []
+if hasattr(os, 'mkfifo'):
+    fifo = test.obj_dir + "/fifo.mem"
+    if os.path.exists(fifo):
+        os.unlink(fifo)
+    os.mkfifo(fifo)
+
+    def feed():
+        # Blocks until the simulation opens the FIFO
+        with open(fifo, 'w', encoding="utf8") as fh:
+            fh.write("12\n34\n56\n78\n")
+
+    threading.Thread(target=feed, daemon=True).start()
+    flags = ["-DTEST_FIFO"]
+
+test.compile(verilator_flags2=flags)
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,79 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+`define STRINGIFY(x) `"x`"
+`define MEM(name) {`STRINGIFY(`TEST_OBJ_DIR), "/", name}
+
+module t;
+   reg [7:0] noeol [4];
+   reg [99:0] noeol_wide [2];
+   reg [7:0] crlf [4];
+   reg [7:0] eof_comment [4];
+   reg [7:0] eof_addr [8];
+   reg [3:0] crlf_bin [3];
+   reg [7:0] empty [2];
+   reg [7:0] fifo [4];
+
+   initial begin
+      foreach (noeol[i]) noeol[i] = 8'hee;
+      $readmemh(`MEM("noeol.mem"), noeol);
+      `checkh(noeol[0], 8'h01);
+      `checkh(noeol[1], 8'h10);
+      `checkh(noeol[2], 8'h20);
+      `checkh(noeol[3], 8'h30);
+
+      $readmemh(`MEM("noeol_wide.mem"), noeol_wide);
+      `checkh(noeol_wide[0], 100'h1_23456789_abcdef01_23456789);
+      `checkh(noeol_wide[1], 100'hf_edcba987_65432100_fedcba98);
+
+      $readmemh(`MEM("crlf.mem"), crlf);
+      `checkh(crlf[0], 8'h11);
+      `checkh(crlf[1], 8'h22);
+      `checkh(crlf[2], 8'h33);
+      `checkh(crlf[3], 8'h44);
+
+      $readmemb(`MEM("crlf_bin.mem"), crlf_bin);
+      `checkh(crlf_bin[0], 4'b1010);
+      `checkh(crlf_bin[1], 4'b0101);
+      `checkh(crlf_bin[2], 4'b1111);
+
+      foreach (eof_comment[i]) eof_comment[i] = 8'hee;
+      $readmemh(`MEM("eof_comment.mem"), eof_comment);
+      `checkh(eof_comment[0], 8'haa);
+      `checkh(eof_comment[1], 8'hbb);
+      `checkh(eof_comment[2], 8'hee);
+      `checkh(eof_comment[3], 8'hee);
+
+      foreach (eof_addr[i]) eof_addr[i] = 8'hee;
+      $readmemh(`MEM("eof_addr.mem"), eof_addr);
+      `checkh(eof_addr[0], 8'hee);
+      `checkh(eof_addr[1], 8'hcc);
+      `checkh(eof_addr[2], 8'hdd);
+      `checkh(eof_addr[3], 8'hee);
+      `checkh(eof_addr[5], 8'hee);
+
+      // Nothing to read, memory unchanged
+      empty[0] = 8'h5a;
+      empty[1] = 8'ha5;
+      $readmemh(`MEM("empty.mem"), empty);
+      `checkh(empty[0], 8'h5a);
+      `checkh(empty[1], 8'ha5);
+
+`ifdef TEST_FIFO
+      // Not a regular file, read without memory mapping
+      $readmemh(`MEM("fifo.mem"), fifo);
+      `checkh(fifo[0], 8'h12);
+      `checkh(fifo[1], 8'h34);
+      `checkh(fifo[2], 8'h56);
+      `checkh(fifo[3], 8'h78);
+`endif
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
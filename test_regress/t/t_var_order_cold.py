@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_opt_activity_gating.v"
+
+test.compile(verilator_flags2=["--stats"])
+
+test.execute()
+
+# Variables only used by initialization are placed after those used by eval
+test.file_grep(test.stats, r'Variable order, cold variables\s+[1-9]')
+
+test.passes()
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+
+test.compile(verilator_flags2=["--stats", "--no-threads-coarsen"], threads=4)
+
+test.execute()
+
+# Variables written by different threads are placed in separate cache lines
+test.file_grep(test.stats, r'Variable order, cross-thread written cache lines, before\s+[1-9]')
+
+# After grouping by writer thread none remain (zero sums are not reported)
+test.file_grep_not(test.stats, r'cross-thread written cache lines, after\s+[1-9]')
+
+# Each thread's group starts on its own cache line
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + "___024root.h",
+               r'alignas\(VL_CACHE_LINE_BYTES\) \S')
+
+test.passes()
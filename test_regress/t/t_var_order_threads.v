@@ -0,0 +1,38 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  int cyc = 0;
+
+  // Independent, narrow state, updated by separate logic
+  logic [7:0] a = 8'h01;
+  logic [7:0] b = 8'h02;
+  logic [7:0] c = 8'h03;
+  logic [7:0] d = 8'h04;
+
+  function automatic logic [7:0] scramble(logic [7:0] v);
+    logic [63:0] x = {8{v}};
+    for (int i = 0; i < 24; ++i) x = {x[62:0], x[63] ^ x[60]} + (x >> 7);
+    return x[7:0] ^ x[15:8] ^ x[63:56];
+  endfunction
+
+  always @(posedge clk) a <= scramble(a);
+  always @(posedge clk) b <= scramble(b);
+  always @(posedge clk) c <= scramble(c);
+  always @(posedge clk) d <= scramble(d);
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    if (cyc == 20) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
@@ -0,0 +1,22 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+module t (
+    input clk,
+    input [7:0] in_n,
+    input [69:0] in_w,
+    output [7:0] out_n,
+    output [69:0] out_w,
+    output reg [31:0] cnt
+);
+  assign out_n = in_n;
+  assign out_w = ~in_w;
+
+  initial cnt = 0;
+  always @(posedge clk) cnt <= cnt + 32'(in_n != 0);
+endmodule
@@ -0,0 +1,68 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include VM_PREFIX_INCLUDE
+
+int errors = 0;
+
+int sc_main(int argc, char** argv) {
+    using namespace sc_core;
+    Verilated::commandArgs(argc, argv);
+
+    sc_signal<bool> clk;
+    sc_signal<uint32_t> in;
+    // Initial values differ from the first values the model writes, so each
+    // output must be written, even if its value happens to equal the
+    // randomly reset state of the model
+    sc_signal<bool> o0{"o0", true};
+    sc_signal<bool> o1{"o1", true};
+    sc_signal<bool> o2{"o2", true};
+    sc_signal<bool> o3{"o3", true};
+    sc_signal<bool> o4{"o4", true};
+    sc_signal<bool> o5{"o5", true};
+    sc_signal<bool> o6{"o6", true};
+    sc_signal<bool> o7{"o7", true};
+    const sc_signal<bool>* const outs[] = {&o0, &o1, &o2, &o3, &o4, &o5, &o6, &o7};
+
+    VM_PREFIX* const tb = new VM_PREFIX{"tb"};
+    tb->clk(clk);
+    tb->in(in);
+    tb->o0(o0);
+    tb->o1(o1);
+    tb->o2(o2);
+    tb->o3(o3);
+    tb->o4(o4);
+    tb->o5(o5);
+    tb->o6(o6);
+    tb->o7(o7);
+
+    sc_start(1, SC_NS);
+    for (const uint32_t value : {0x00U, 0xffU, 0x00U, 0x5aU, 0x5aU, 0xa5U}) {
+        in.write(value);
+        clk.write(false);
+        sc_start(1, SC_NS);
+        clk.write(true);
+        sc_start(1, SC_NS);
+        for (int i = 0; i < 8; ++i) {
+            if (outs[i]->read() != ((value >> i) & 1)) {
+                VL_PRINTF("%%Error: %s:%d: o%d mismatch after in=0x%02x\n", __FILE__, __LINE__,
+                          i, value);
+                ++errors;
+            }
+        }
+    }
+
+    tb->final();
+    VL_DO_DANGLING(delete tb, tb);
+    if (errors) vl_fatal(__FILE__, __LINE__, "top", "Unexpected results from test\n");
+    VL_PRINTF("*-* All Finished *-*\n");
+    return 0;
+}
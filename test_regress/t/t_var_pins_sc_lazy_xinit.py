@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.pli_filename = "t/" + test.name + ".cpp"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=[
+                 "--exe", test.pli_filename, "--sc --pins-sc-lazy --x-initial unique --stats"
+             ])
+
+test.file_grep(test.stats, r'Optimizations, SystemC lazy output writes\s+[1-9]')
+
+for seed in range(1, 5):
+    test.execute(all_run_flags=["+verilator+rand+reset+2", f"+verilator+seed+{seed}"])
+
+test.passes()
@@ -0,0 +1,32 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+module t (
+    input clk,
+    input [7:0] in,
+    // Only ever written by clocked logic
+    output reg o0,
+    output reg o1,
+    output reg o2,
+    output reg o3,
+    output reg o4,
+    output reg o5,
+    output reg o6,
+    output reg o7
+);
+  always @(posedge clk) begin
+    o0 <= in[0];
+    o1 <= in[1];
+    o2 <= in[2];
+    o3 <= in[3];
+    o4 <= in[4];
+    o5 <= in[5];
+    o6 <= in[6];
+    o7 <= in[7];
+  end
+endmodule
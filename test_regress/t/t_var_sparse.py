@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(verilator_flags2=['--stats', '--sparse-threshold', '65536'])
+
+test.execute()
+
+test.file_grep(test.stats, r'Optimizations, Sparse arrays\s+(\d+)', 3)
+test.file_grep_any(test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.h"),
+                   r'VlSparseUnpacked<')
+test.files_identical(test.obj_dir + "/t_var_sparse.mem", "t/t_var_sparse__mem.out")
+
+test.passes()
@@ -0,0 +1,63 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+`define STRINGIFY(x) `"x`"
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t(/*AUTOARG*/
+  // Inputs
+  clk
+  );
+
+   input clk;
+   int   cyc = 0;
+
+   // 64 MiB if stored normally
+   logic [31:0] mem [0:(1 << 24) - 1] /*verilator sparse*/;
+   logic [95:0] wmem [0:65535] /*verilator sparse*/;
+   // Sparse due to --sparse-threshold
+   logic [7:0] bmem [1:(1 << 20) - 1];
+   // Not sparse, below threshold
+   logic [7:0] small [0:15];
+
+   logic [23:0] addr;
+
+   always_ff @ (posedge clk) begin
+      cyc <= cyc + 1;
+      addr <= addr + 24'h10001;
+      if (cyc == 0) begin
+         addr <= 24'h123456;
+         `checkh(mem[24'hfff000], 32'h0);
+         `checkh(wmem[16'h8000], 96'h0);
+         `checkh(bmem[1], 8'h0);
+         $readmemh("t/t_var_sparse.mem", mem);
+      end
+      else if (cyc == 1) begin
+         `checkh(mem[24'hfff000], 32'h12345678);
+         `checkh(mem[24'hfff001], 32'hdeadbeef);
+         `checkh(mem[24'hfff002], 32'h0);
+         `checkh(mem[24'h000010], 32'h0000cafe);
+         mem[addr] <= 32'h5a5a5a5a;
+         wmem[addr[15:0]] <= {addr, 72'h1};
+         bmem[{4'h0, addr[15:0]} + 20'h1] <= addr[7:0];
+         small[addr[3:0]] <= addr[15:8];
+      end
+      else if (cyc == 2) begin
+         `checkh(mem[24'h123456], 32'h5a5a5a5a);
+         `checkh(mem[24'h123457], 32'h0);
+         `checkh(wmem[16'h3456], {24'h123456, 72'h1});
+         `checkh(wmem[16'h3457], 96'h0);
+         `checkh(bmem[20'h3457], 8'h56);
+         `checkh(small[6], 8'h34);
+         $writememh({`STRINGIFY(`TEST_OBJ_DIR),"/t_var_sparse.mem"}, mem, 24'hfff000, 24'hfff003);
+      end
+      else if (cyc == 3) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,29 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t(/*AUTOARG*/
+  // Outputs
+  o,
+  // Inputs
+  clk, idx
+  );
+
+   input clk;
+   input [3:0] idx;
+   output logic [7:0] o;
+
+   logic [7:0] multi [0:3][0:3] /*verilator sparse*/;
+   logic [7:0] pub [0:3] /*verilator public*/ /*verilator sparse*/;
+   logic [7:0] whole [0:3] /*verilator sparse*/;
+
+   always_ff @(posedge clk) begin
+      multi[idx[1:0]][idx[3:2]] <= {4'h0, idx};
+      pub[idx[1:0]] <= {4'h0, idx};
+      whole[idx[1:0]] <= {4'h0, idx};
+      o <= multi[0][1] + pub[1];
+      $display("%p", whole);
+   end
+endmodule
@@ -0,0 +1,108 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include "TestVpi.h"
+#include "Vt_vpi_bulk.h"
+
+#include <cstring>
+#include <memory>
+
+static vpiHandle handle(const char* namep) {
+    return vpi_handle_by_name(const_cast<PLI_BYTE8*>(namep), nullptr);
+}
+
+static int test(VM_PREFIX* topp) {
+    VerilatedVpiBulk in;
+    CHECK_RESULT(in.add(handle("t.a5")), 0);
+    CHECK_RESULT(in.add(handle("t.a12")), 1);
+    CHECK_RESULT(in.add(handle("t.a70")), 2);
+    const TestVpiHandle memh = handle("t.mem");
+    CHECK_RESULT(in.add(memh), -1);  // Whole unpacked array not supported
+    CHECK_RESULT(vpi_chk_error(nullptr), vpiError);
+    CHECK_RESULT(in.add(vpi_handle_by_index(memh, 2)), 3);
+    CHECK_RESULT(in.size(), 4U);
+    CHECK_RESULT(in.bytes(), 1U + 2U + 9U + 2U);
+    CHECK_RESULT(in.byteOffset(2), 3U);
+    CHECK_RESULT(in.byteSize(2), 9U);
+
+    VerilatedVpiBulk out;
+    out.add(handle("t.y5"));
+    out.add(handle("t.y12"));
+    out.add(handle("t.y70"));
+    out.add(handle("t.ymem"));
+    CHECK_RESULT(out.bytes(), in.bytes());
+    // Outputs are read-only
+    uint8_t buf[14];
+    CHECK_RESULT(out.put(buf), false);
+    CHECK_RESULT(vpi_chk_error(nullptr), vpiError);
+
+    // Immediate put, with bits above each signal's width ignored
+    std::memset(buf, 0, sizeof(buf));
+    buf[0] = 0xe3;  // a5 = 3
+    buf[1] = 0x34;  // a12 = 0x234
+    buf[2] = 0xf2;
+    buf[3] = 0x01;  // a70 = 1 << 69 | 1
+    buf[11] = 0xe0;
+    buf[12] = 0x21;  // mem[2] = 0x321
+    buf[13] = 0x03;
+    VerilatedVpi::clearEvalNeeded();
+    CHECK_RESULT(in.put(buf), true);
+    CHECK_RESULT(VerilatedVpi::evalNeeded(), true);
+    topp->eval();
+    uint8_t got[14];
+    in.get(got);
+    CHECK_RESULT_HEX(static_cast<int>(got[0]), 0x03);
+    CHECK_RESULT_HEX(static_cast<int>(got[2]), 0x02);
+    CHECK_RESULT_HEX(static_cast<int>(got[11]), 0x20);
+    out.get(got);
+    CHECK_RESULT_HEX(static_cast<int>(got[0]), 0x04);  // y5 = a5 + 1
+    CHECK_RESULT_HEX(static_cast<int>(got[1]), 0xcb);  // y12 = ~a12
+    CHECK_RESULT_HEX(static_cast<int>(got[2]), 0x0d);
+    CHECK_RESULT_HEX(static_cast<int>(got[3]), 0x03);  // y70 = rotate left of a70
+    CHECK_RESULT_HEX(static_cast<int>(got[11]), 0x00);
+    CHECK_RESULT_HEX(static_cast<int>(got[12]), 0x2e);  // ymem = mem[2] ^ 0xf
+    CHECK_RESULT_HEX(static_cast<int>(got[13]), 0x03);
+
+    // Scheduled put only applies at doInertialPuts
+    buf[0] = 0x10;
+    VerilatedVpi::clearEvalNeeded();
+    CHECK_RESULT(in.putScheduled(buf), true);
+    std::memset(buf, 0, sizeof(buf));  // Buffer was copied
+    in.get(got);
+    CHECK_RESULT_HEX(static_cast<int>(got[0]), 0x03);
+    CHECK_RESULT(VerilatedVpi::evalNeeded(), false);
+    VerilatedVpi::doInertialPuts();
+    CHECK_RESULT(VerilatedVpi::evalNeeded(), true);
+    topp->eval();
+    out.get(got);
+    CHECK_RESULT_HEX(static_cast<int>(got[0]), 0x11);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    contextp->fatalOnVpiError(false);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(),
+                                                        // Note null name - we're flattening it out
+                                                        ""}};
+    topp->eval();
+    if (const int line = test(topp.get())) {
+        printf("%%Error: Failure at line %d\n", line);
+        return 1;
+    }
+    topp->final();
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
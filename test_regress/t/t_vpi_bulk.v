@@ -0,0 +1,23 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    clk
+);
+
+  input clk;
+
+  logic [4:0] a5  /*verilator public_flat_rw*/;
+  logic [11:0] a12  /*verilator public_flat_rw*/;
+  logic [69:0] a70  /*verilator public_flat_rw*/;
+  logic [11:0] mem[0:3]  /*verilator public_flat_rw*/;
+
+  wire [4:0] y5  /*verilator public_flat_rd*/ = a5 + 5'd1;
+  wire [11:0] y12  /*verilator public_flat_rd*/ = ~a12;
+  wire [69:0] y70  /*verilator public_flat_rd*/ = {a70[68:0], a70[69]};
+  wire [11:0] ymem  /*verilator public_flat_rd*/ = mem[2] ^ 12'h00f;
+
+endmodule
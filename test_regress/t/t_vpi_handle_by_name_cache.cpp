@@ -0,0 +1,75 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include "Vt_vpi_handle_by_name_cache.h"
+#include "vpi_user.h"
+
+#include <iostream>
+#include <memory>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+#include "TestSimulator.h"
+#include "TestVpi.h"
+
+int errors = 0;
+
+// Value of the signal found by name, or -1 if the name is not found
+static int value_by_name(const char* namep) {
+    TestVpiHandle vh = vpi_handle_by_name(const_cast<PLI_BYTE8*>(namep), nullptr);
+    if (!vh) return -1;
+    s_vpi_value v;
+    v.format = vpiIntVal;
+    vpi_get_value(vh, &v);
+    return v.value.integer;
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> top1p{new VM_PREFIX{contextp.get(), "top1"}};
+    top1p->in = 10;
+    top1p->eval();
+
+    // Repeated lookups, the second from the cache
+    TEST_CHECK_EQ(value_by_name("top1.t.sig"), 11);
+    TEST_CHECK_EQ(value_by_name("top1.t.sig"), 11);
+    // Misses, also repeated
+    TEST_CHECK_EQ(value_by_name("top2.t.sig"), -1);
+    TEST_CHECK_EQ(value_by_name("top2.t.sig"), -1);
+    TEST_CHECK_EQ(value_by_name("top1.t.nosig"), -1);
+
+    {
+        // A new model adds scopes, so the earlier miss must not be returned
+        const std::unique_ptr<VM_PREFIX> top2p{new VM_PREFIX{contextp.get(), "top2"}};
+        top2p->in = 20;
+        top2p->eval();
+        TEST_CHECK_EQ(value_by_name("top2.t.sig"), 21);
+        TEST_CHECK_EQ(value_by_name("top2.t.sig"), 21);
+        TEST_CHECK_EQ(value_by_name("top1.t.sig"), 11);
+        TEST_CHECK_EQ(value_by_name("top1.t.nosig"), -1);
+    }
+
+    // Deleting the model removes its scopes, so the earlier hit must not be returned
+    TEST_CHECK_EQ(value_by_name("top2.t.sig"), -1);
+    TEST_CHECK_EQ(value_by_name("top1.t.sig"), 11);
+    top1p->in = 30;
+    top1p->eval();
+    TEST_CHECK_EQ(value_by_name("top1.t.sig"), 31);
+
+    top1p->final();
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
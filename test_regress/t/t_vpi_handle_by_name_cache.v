@@ -0,0 +1,15 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input [7:0] in
+);
+
+  logic [7:0] sig  /*verilator public_flat_rd*/;
+
+  always_comb sig = in + 8'd1;
+
+endmodule
@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.pli_filename = "t/t_vpi_var.cpp"
+test.top_filename = "t/t_vpi_var.v"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             make_pli=True,
+             sim_time=2100,
+             v_flags2=["+define+USE_VPI_NOT_DPI"],
+             verilator_flags2=[
+                 "-Wno-SYMRSVDWORD --exe --vpi --vpi-change-flags --no-l2name --stats",
+                 test.pli_filename
+             ])
+
+test.execute(use_libvpi=True, all_run_flags=['+PLUS +INT=1234 +STRSTR'])
+
+test.file_grep_not(test.stats, r'Optimizations, VPI change flags\s+0$')
+
+test.passes()
@@ -0,0 +1,129 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include "Vt_vpi_var_change_flags_cbs.h"
+#include "Vt_vpi_var_change_flags_cbs__Dpi.h"
+#include "vpi_user.h"
+
+#include <cstring>
+#include <iostream>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+#include "TestSimulator.h"
+#include "TestVpi.h"
+
+int errors = 0;
+
+constexpr int NSIGNALS = 3;
+const char* const signalNames[NSIGNALS] = {"flagged", "scanned", "viadpi"};
+TestVpiHandle signalHandles[NSIGNALS];
+TestVpiHandle callbackHandles[NSIGNALS];
+int callbackCounts[NSIGNALS] = {};  // Number of callbacks received
+int changeCounts[NSIGNALS] = {};  // Number of value changes seen by polling
+int prevValues[NSIGNALS] = {};
+
+void dpi_value(int cyc, char* v) { *v = static_cast<char>(cyc / 3); }
+
+static int the_value_callback(p_cb_data cb_data) {
+    ++*reinterpret_cast<int*>(cb_data->user_data);
+    return 0;
+}
+
+static int get_value(int i) {
+    s_vpi_value v;
+    v.format = vpiIntVal;
+    vpi_get_value(signalHandles[i], &v);
+    return v.value.integer;
+}
+
+static void register_cbs() {
+    for (int i = 0; i < NSIGNALS; ++i) {
+        signalHandles[i] = VPI_HANDLE(signalNames[i]);
+        TEST_CHECK_NZ(signalHandles[i]);
+        prevValues[i] = get_value(i);
+
+        s_vpi_value v;
+        v.format = vpiSuppressVal;
+        t_cb_data cb_data;
+        bzero(&cb_data, sizeof(cb_data));
+        cb_data.reason = cbValueChange;
+        cb_data.cb_rtn = the_value_callback;
+        cb_data.obj = signalHandles[i];
+        cb_data.value = &v;
+        cb_data.user_data = reinterpret_cast<PLI_BYTE8*>(&callbackCounts[i]);
+        callbackHandles[i] = vpi_register_cb(&cb_data);
+        TEST_CHECK_NZ(callbackHandles[i]);
+    }
+}
+
+// Call value callbacks, and check each signal got exactly one callback per change
+static void call_and_check_cbs() {
+    VerilatedVpi::callValueCbs();
+    for (int i = 0; i < NSIGNALS; ++i) {
+        const int value = get_value(i);
+        if (value != prevValues[i]) ++changeCounts[i];
+        prevValues[i] = value;
+        if (callbackCounts[i] != changeCounts[i]) {
+            std::cout << "%Error: " << signalNames[i] << ": callbacks " << callbackCounts[i]
+                      << " changes " << changeCounts[i] << std::endl;
+            ++errors;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(),
+                                                        // Note null name - we're flattening it out
+                                                        ""}};
+
+    topp->clk = 0;
+    topp->eval();
+    register_cbs();
+
+    while (contextp->time() < 100 && !contextp->gotFinish()) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+        call_and_check_cbs();
+        if (contextp->time() == 20) {
+            // A write by vpi_put_value must also be noticed
+            s_vpi_value v;
+            v.format = vpiIntVal;
+            v.value.integer = get_value(0) + 100;
+            vpi_put_value(signalHandles[0], &v, nullptr, vpiNoDelay);
+            call_and_check_cbs();
+        }
+        if (errors) vl_stop(__FILE__, __LINE__, "TOP-cpp");
+    }
+
+    if (!contextp->gotFinish()) {
+        vl_fatal(__FILE__, __LINE__, "main", "%Error: Timeout; never got a $finish");
+    }
+    topp->final();
+
+    // Each signal changed several times
+    for (int i = 0; i < NSIGNALS; ++i) {
+        if (changeCounts[i] < 4) {
+            std::cout << "%Error: " << signalNames[i] << ": only " << changeCounts[i]
+                      << " changes" << std::endl;
+            ++errors;
+        }
+    }
+
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--exe --vpi --vpi-change-flags --stats", test.pli_filename])
+
+test.execute()
+
+# 'flagged' has a change flag, 'scanned' is written by $sscanf so has none
+test.file_grep(test.stats, r'Optimizations, VPI change flags\s+[1-9]')
+test.file_grep(test.stats, r'Optimizations, VPI change flags not possible\s+[1-9]')
+
+test.passes()
@@ -0,0 +1,35 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+import "DPI-C" function void dpi_value(input int cyc, output byte v);
+
+module t (
+    input clk
+);
+
+  int cyc = 0;
+  string s;
+
+  // Written by an assignment every cycle, but only changes every other cycle
+  logic [7:0] flagged  /*verilator public_flat_rw*/ = 0;
+  // Written by $sscanf, not an assignment, so has no flag
+  logic [7:0] scanned  /*verilator public_flat_rd*/ = 0;
+  // Written by a DPI output argument
+  byte viadpi  /*verilator public_flat_rd*/ = 0;
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    flagged <= flagged + {7'd0, cyc[0]};
+    s = $sformatf("%0d", cyc / 4);
+    if ($sscanf(s, "%d", scanned) != 1) $stop;
+    dpi_value(cyc, viadpi);
+    if (cyc == 24) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule